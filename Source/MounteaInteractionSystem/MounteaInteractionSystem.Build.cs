@@ -16,7 +16,8 @@ public class MounteaInteractionSystem : ModuleRules
 				"Core",
 				"UMG",
 				"InputCore",
-				"Engine"
+				"Engine",
+				"NetCore"
 			}
 		);
 		
@@ -34,7 +35,6 @@ public class MounteaInteractionSystem : ModuleRules
 				"InputCore",
 				"GameplayTags",
 				"EnhancedInput",
-				"NetCore",
 				"EnhancedInput",
 				"ApplicationCore",
 				"CommonInput",
@@ -18,11 +18,17 @@ UMounteaInteractableComponentAutomatic::UMounteaInteractableComponentAutomatic()
 	bInteractionHighlight = false;
 }
 
-void UMounteaInteractableComponentAutomatic::BeginPlay()
+const FMounteaInteractableEventHandlers& UMounteaInteractableComponentAutomatic::GetEventHandlers() const
 {
-	Super::BeginPlay();
+	// Automatic interaction cannot be stopped
+	static const FMounteaInteractableEventHandlers AutomaticHandlers = []
+	{
+		FMounteaInteractableEventHandlers Handlers = GetDefaultEventHandlers();
+		Handlers.InteractionStopped = nullptr;
+		return Handlers;
+	}();
 
-	OnInteractionStopped.RemoveAll(this);
+	return AutomaticHandlers;
 }
 
 void UMounteaInteractableComponentAutomatic::InteractableSelected_Implementation(const TScriptInterface<IMounteaInteractableInterface>& Interactable)
@@ -34,7 +40,7 @@ void UMounteaInteractableComponentAutomatic::InteractableSelected_Implementation
 	{
 		if (GetWorld()->GetTimerManager().IsTimerActive(Timer_Interaction) == false)
 		{
-			OnInteractionStarted.Broadcast(GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
+			BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionStarted, OnInteractionStartedNative, OnInteractionStarted, GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
 		}
 	}
 }
@@ -94,7 +100,7 @@ void UMounteaInteractableComponentAutomatic::OnInteractionCompletedCallback()
 {
 	if (!GetWorld())
 	{
-		OnInteractionCanceled.Broadcast();
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionCanceled, OnInteractionCanceledNative, OnInteractionCanceled);
 		return;
 	}
 
@@ -104,7 +110,7 @@ void UMounteaInteractableComponentAutomatic::OnInteractionCompletedCallback()
 		if (Execute_TriggerCooldown(this)) return;
 	}
 	
-	OnInteractionCompleted.Broadcast(GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionCompleted, OnInteractionCompletedNative, OnInteractionCompleted, GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
 }
 
 #undef LOCTEXT_NAMESPAC
\ No newline at end of file
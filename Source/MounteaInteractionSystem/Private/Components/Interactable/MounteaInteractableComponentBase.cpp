@@ -16,16 +16,30 @@
 
 #include "Components/BillboardComponent.h"
 #include "Components/WidgetComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "GameFramework/GameStateBase.h"
 #include "GameFramework/InputDeviceSubsystem.h"
 
+#include "Helpers/MounteaInteractableSetupTemplate.h"
 #include "Helpers/MounteaInteractionFunctionLibrary.h"
 #include "Helpers/MounteaInteractionSystemBFL.h"
+#include "Helpers/MounteaInteractionSystemSettings.h"
+#include "Helpers/MounteaInteractionSystemStats.h"
+
+#include "Components/Interactor/MounteaInteractorComponentBase.h"
 
 #include "Interfaces/MounteaInteractionWidget.h"
 #include "Interfaces/MounteaInteractorInterface.h"
+#include "Networking/MounteaInteractionStateManager.h"
 
+#include "Subsystems/MounteaHighlightSubsystem.h"
+#include "Subsystems/MounteaInteractionDependencySubsystem.h"
+#include "Subsystems/MounteaInteractionRegistrySubsystem.h"
 
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "UObject/UObjectHash.h"
 
 #define LOCTEXT_NAMESPACE "MounteaInteractableComponentBase"
 
@@ -42,13 +56,21 @@ UMounteaInteractableComponentBase::UMounteaInteractableComponentBase() :
 		bInteractionHighlight(true),
 		StencilID(133),
 		bCanPersist(false),
+		bManageOwnerNetDormancy(true),
 		InteractableName(LOCTEXT("MounteaInteractableComponentBase", "Base")),
 		ComparisonMethod(ETimingComparison::ECM_None),
 		TimeToStart(0.001f),
 		InteractableState(EInteractableStateV2::EIS_Awake),
 		RemainingLifecycleCount(LifecycleCount),
 		CachedInteractionWeight(InteractionWeight),
-		bInteractableInitialized(false)
+		bInteractableInitialized(false),
+		bOwnerNetDormant(false),
+		bInteractorFoundBroadcast(false),
+		CosmeticState(0),
+		AppliedCosmeticState(0),
+		StateSnapshotOverrides(0),
+		bHasPendingStateSnapshot(false),
+		bInputModeChangedBound(false)
 {
 	bAutoActivate = true;
 	
@@ -76,109 +98,241 @@ void UMounteaInteractableComponentBase::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Interaction Events
-	{
-		OnInteractableSelected.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnInteractableSelectedEvent);
-		OnInteractorFound.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractorFound);
-		OnInteractorLost.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractorLost);
-
-		OnInteractorOverlapped.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnInteractableBeginOverlapEvent);
-		OnInteractorStopOverlap.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnInteractableStopOverlapEvent);
-		OnInteractorTraced.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnInteractableTraced);
+	NativeDispatchFunctions = FMounteaInteractableDispatch::GetNativeFunctions(GetClass());
 
-		OnInteractionCompleted.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractionCompleted);
-		OnInteractionCycleCompleted.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractionCycleCompleted);
-		OnInteractionStarted.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractionStarted);
-		OnInteractionStopped.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractionStopped);
-		OnInteractionCanceled.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractionCanceled);
-		OnLifecycleCompleted.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractionLifecycleCompleted);
-		OnCooldownCompleted.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractionCooldownCompleted);
-	}
+	// Own events are handled through static Event Handlers table, nothing is bound here
 	
-	// Attributes Events
-	{
-		OnInteractableDependencyChanged.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnInteractableDependencyChangedEvent);
-		OnInteractableAutoSetupChanged.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnInteractableAutoSetupChangedEvent);
-		OnInteractableWeightChanged.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnInteractableWeightChangedEvent);
-		OnInteractableStateChanged.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnInteractableStateChangedEvent);
-		OnInteractableOwnerChanged.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnInteractableOwnerChangedEvent);
-		OnInteractableCollisionChannelChanged.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnInteractableCollisionChannelChangedEvent);
-		OnLifecycleModeChanged.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnLifecycleModeChangedEvent);
-		OnLifecycleCountChanged.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnLifecycleCountChangedEvent);
-		OnCooldownPeriodChanged.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnCooldownPeriodChangedEvent);
-		OnInteractorChanged.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnInteractorChangedEvent);
-	}
+	RemainingLifecycleCount = LifecycleCount;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, RemainingLifecycleCount, this);
+	
+	Execute_SetState(this, DefaultInteractableState);
+
+	ResolveIgnoredClasses();
 
-	// Ignored Classes Events
+	// Loaded values above must not override Snapshot received from Server
+	if (bHasPendingStateSnapshot)
 	{
-		OnIgnoredInteractorClassAdded.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnIgnoredClassAdded);
-		OnIgnoredInteractorClassRemoved.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnIgnoredClassRemoved);
+		bHasPendingStateSnapshot = false;
+		ApplyStateSnapshot(PendingStateSnapshot);
 	}
 
-	// Highlight Events
+	// Registry might defer registration to spread cost of mass spawns over multiple frames
+	UMounteaInteractionRegistrySubsystem* Registry = UMounteaInteractionRegistrySubsystem::Get(this);
+	if (!Registry || !Registry->QueueInteractableRegistration(this))
 	{
-		OnHighlightableComponentAdded.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnHighlightableComponentAddedEvent);
-		OnHighlightableComponentRemoved.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnHighlightableComponentRemovedEvent);
+		CompleteRegistration();
 	}
+
+#if WITH_EDITOR
 	
-	// Collision Events
+	DrawDebug();
+
+#endif
+}
+
+void UMounteaInteractableComponentBase::CompleteRegistration()
+{
+	if (UMounteaInteractionRegistrySubsystem* Registry = UMounteaInteractionRegistrySubsystem::Get(this))
 	{
-		OnCollisionComponentAdded.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnCollisionComponentAddedEvent);
-		OnCollisionComponentRemoved.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnCollisionComponentRemovedEvent);
+		Registry->RegisterInteractable(this);
 	}
 
-	// Widget
+	if (bAutoActivate)
 	{
-		OnWidgetUpdated.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnWidgetUpdatedEvent);
+		AutoSetup();
 	}
-	
-	// Highlight
+}
+
+void UMounteaInteractableComponentBase::SetInstanceEventHandlers(const FMounteaInteractableEventHandlers& NewHandlers)
+{
+	InstanceEventHandlers = MakeUnique<FMounteaInteractableEventHandlers>(NewHandlers);
+}
+
+void UMounteaInteractableComponentBase::ResetInstanceEventHandlers()
+{
+	InstanceEventHandlers.Reset();
+}
+
+const FMounteaInteractableEventHandlers& UMounteaInteractableComponentBase::GetDefaultEventHandlers()
+{
+	static const FMounteaInteractableEventHandlers DefaultHandlers = []
+	{
+		using ThisClass = UMounteaInteractableComponentBase;
+		FMounteaInteractableEventHandlers Handlers;
+
+		// Interface events are called through Execute_, so Blueprint overrides are respected
+		Handlers.InteractableSelected = [](ThisClass* Self, const TScriptInterface<IMounteaInteractableInterface>& Interactable)
+		{ Execute_OnInteractableSelectedEvent(Self, Interactable); };
+		Handlers.InteractorFound = [](ThisClass* Self, const TScriptInterface<IMounteaInteractorInterface>& FoundInteractor)
+		{ Execute_InteractorFound(Self, FoundInteractor); };
+		Handlers.InteractorLost = [](ThisClass* Self, const TScriptInterface<IMounteaInteractorInterface>& LostInteractor)
+		{ Execute_InteractorLost(Self, LostInteractor); };
+		Handlers.InteractorTraced = [](ThisClass* Self, UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
+		{ Self->OnInteractableTraced(HitComponent, OtherActor, OtherComp, NormalImpulse, Hit); };
+		Handlers.InteractorOverlapped = [](ThisClass* Self, UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+		{ Execute_OnInteractableBeginOverlapEvent(Self, OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex, bFromSweep, SweepResult); };
+		Handlers.InteractorStopOverlap = [](ThisClass* Self, UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+		{ Execute_OnInteractableStopOverlapEvent(Self, OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex); };
+		Handlers.InteractionCompleted = [](ThisClass* Self, const float& TimeCompleted, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor)
+		{ Execute_InteractionCompleted(Self, TimeCompleted, CausingInteractor); };
+		Handlers.InteractionCycleCompleted = [](ThisClass* Self, const float& CompletedTime, const int32 CyclesRemaining, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor)
+		{ Execute_InteractionCycleCompleted(Self, CompletedTime, CyclesRemaining, CausingInteractor); };
+		Handlers.InteractionStarted = [](ThisClass* Self, const float& TimeStarted, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor)
+		{ Execute_InteractionStarted(Self, TimeStarted, CausingInteractor); };
+		Handlers.InteractionStopped = [](ThisClass* Self, const float& TimeStopped, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor)
+		{ Execute_InteractionStopped(Self, TimeStopped, CausingInteractor); };
+		Handlers.InteractionCanceled = [](ThisClass* Self)
+		{ Execute_InteractionCanceled(Self); };
+		Handlers.LifecycleCompleted = [](ThisClass* Self)
+		{ Execute_InteractionLifecycleCompleted(Self); };
+		Handlers.CooldownCompleted = [](ThisClass* Self)
+		{ Execute_InteractionCooldownCompleted(Self); };
+
+		Handlers.InteractableDependencyChanged = [](ThisClass* Self, const TScriptInterface<IMounteaInteractableInterface>& Dependency)
+		{ Self->OnInteractableDependencyChangedEvent(Dependency); };
+		Handlers.InteractableAutoSetupChanged = [](ThisClass* Self, const bool NewValue)
+		{ Self->OnInteractableAutoSetupChangedEvent(NewValue); };
+		Handlers.InteractableWeightChanged = [](ThisClass* Self, const int32& NewWeight)
+		{ Self->OnInteractableWeightChangedEvent(NewWeight); };
+		Handlers.InteractableStateChanged = [](ThisClass* Self, const EInteractableStateV2& NewState)
+		{ Self->OnInteractableStateChangedEvent(NewState); };
+		Handlers.InteractableOwnerChanged = [](ThisClass* Self, const AActor* NewOwner)
+		{ Self->OnInteractableOwnerChangedEvent(NewOwner); };
+		Handlers.InteractableCollisionChannelChanged = [](ThisClass* Self, const ECollisionChannel NewChannel)
+		{ Self->OnInteractableCollisionChannelChangedEvent(NewChannel); };
+		Handlers.LifecycleModeChanged = [](ThisClass* Self, const EInteractableLifecycle& NewMode)
+		{ Self->OnLifecycleModeChangedEvent(NewMode); };
+		Handlers.LifecycleCountChanged = [](ThisClass* Self, const int32 NewLifecycleCount)
+		{ Self->OnLifecycleCountChangedEvent(NewLifecycleCount); };
+		Handlers.CooldownPeriodChanged = [](ThisClass* Self, const float NewCooldownPeriod)
+		{ Self->OnCooldownPeriodChangedEvent(NewCooldownPeriod); };
+		Handlers.InteractorChanged = [](ThisClass* Self, const TScriptInterface<IMounteaInteractorInterface>& NewInteractor)
+		{ Self->OnInteractorChangedEvent(NewInteractor); };
+
+		Handlers.IgnoredInteractorClassAdded = [](ThisClass* Self, const TSoftClassPtr<UObject>& IgnoredClass)
+		{ Self->OnIgnoredClassAdded(IgnoredClass); };
+		Handlers.IgnoredInteractorClassRemoved = [](ThisClass* Self, const TSoftClassPtr<UObject>& IgnoredClass)
+		{ Self->OnIgnoredClassRemoved(IgnoredClass); };
+		Handlers.HighlightableComponentAdded = [](ThisClass* Self, const UMeshComponent* NewHighlightableComp)
+		{ Self->OnHighlightableComponentAddedEvent(NewHighlightableComp); };
+		Handlers.HighlightableComponentRemoved = [](ThisClass* Self, const UMeshComponent* RemovedHighlightableComp)
+		{ Self->OnHighlightableComponentRemovedEvent(RemovedHighlightableComp); };
+		Handlers.CollisionComponentAdded = [](ThisClass* Self, const UPrimitiveComponent* NewCollisionComp)
+		{ Self->OnCollisionComponentAddedEvent(NewCollisionComp); };
+		Handlers.CollisionComponentRemoved = [](ThisClass* Self, const UPrimitiveComponent* RemovedCollisionComp)
+		{ Self->OnCollisionComponentRemovedEvent(RemovedCollisionComp); };
+		Handlers.HighlightTypeChanged = [](ThisClass* Self, const EHighlightType& NewHighlightType)
+		{ Self->OnHighlightTypeChangedEvent(NewHighlightType); };
+		Handlers.HighlightMaterialChanged = [](ThisClass* Self, const UMaterialInterface* NewHighlightMaterial)
+		{ Self->OnHighlightMaterialChangedEvent(NewHighlightMaterial); };
+
+		Handlers.WidgetUpdated = [](ThisClass* Self)
+		{ Self->OnWidgetUpdatedEvent(); };
+		Handlers.InteractableDependencyStarted = [](ThisClass* Self, const TScriptInterface<IMounteaInteractableInterface>& NewMaster)
+		{ Execute_InteractableDependencyStartedCallback(Self, NewMaster); };
+		Handlers.InteractableDependencyStopped = [](ThisClass* Self, const TScriptInterface<IMounteaInteractableInterface>& FormerMaster)
+		{ Execute_InteractableDependencyStoppedCallback(Self, FormerMaster); };
+		Handlers.InteractionDeviceChanged = [](ThisClass* Self, const ECommonInputType DeviceType, const FName& DeviceName)
+		{ Execute_OnInputDeviceChanged(Self, DeviceType, DeviceName); };
+
+		return Handlers;
+	}();
+
+	return DefaultHandlers;
+}
+
+void UMounteaInteractableComponentBase::BroadcastInteractableSelected(const TScriptInterface<IMounteaInteractableInterface>& SelectedInteractable)
+{
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractableSelected, OnInteractableSelectedNative, OnInteractableSelected, SelectedInteractable);
+}
+
+void UMounteaInteractableComponentBase::BroadcastInteractorFound(const TScriptInterface<IMounteaInteractorInterface>& FoundInteractor)
+{
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractorFound, OnInteractorFoundNative, OnInteractorFound, FoundInteractor);
+}
+
+void UMounteaInteractableComponentBase::BroadcastInteractorLost(const TScriptInterface<IMounteaInteractorInterface>& LostInteractor)
+{
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractorLost, OnInteractorLostNative, OnInteractorLost, LostInteractor);
+}
+
+void UMounteaInteractableComponentBase::BroadcastInteractorTraced(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
+{
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractorTraced, OnInteractorTracedNative, OnInteractorTraced, HitComponent, OtherActor, OtherComp, NormalImpulse, Hit);
+}
+
+void UMounteaInteractableComponentBase::BroadcastInteractorOverlapped(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractorOverlapped, OnInteractorOverlappedNative, OnInteractorOverlapped, OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex, bFromSweep, SweepResult);
+}
+
+void UMounteaInteractableComponentBase::BroadcastInteractorStopOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractorStopOverlap, OnInteractorStopOverlapNative, OnInteractorStopOverlap, OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex);
+}
+
+void UMounteaInteractableComponentBase::BroadcastInteractionStarted(const float& TimeStarted, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor)
+{
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionStarted, OnInteractionStartedNative, OnInteractionStarted, TimeStarted, CausingInteractor);
+}
+
+void UMounteaInteractableComponentBase::BroadcastInteractionStopped(const float& TimeStopped, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor)
+{
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionStopped, OnInteractionStoppedNative, OnInteractionStopped, TimeStopped, CausingInteractor);
+}
+
+void UMounteaInteractableComponentBase::BroadcastInteractableDependencyStarted(const TScriptInterface<IMounteaInteractableInterface>& NewMaster)
+{
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractableDependencyStarted, InteractableDependencyStartedNative, InteractableDependencyStarted, NewMaster);
+}
+
+void UMounteaInteractableComponentBase::BroadcastInteractableDependencyStopped(const TScriptInterface<IMounteaInteractableInterface>& FormerMaster)
+{
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractableDependencyStopped, InteractableDependencyStoppedNative, InteractableDependencyStopped, FormerMaster);
+}
+
+void UMounteaInteractableComponentBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UMounteaInteractionRegistrySubsystem* Registry = UMounteaInteractionRegistrySubsystem::Get(this))
 	{
-		OnHighlightTypeChanged.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnHighlightTypeChangedEvent);
-		OnHighlightMaterialChanged.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnHighlightMaterialChangedEvent);
+		Registry->UnregisterInteractable(this);
 	}
 
-	// Dependency
+	if (UMounteaInteractionDependencySubsystem* DependencySubsystem = UMounteaInteractionDependencySubsystem::Get(this))
 	{
-		InteractableDependencyStarted.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractableDependencyStartedCallback);
-		InteractableDependencyStopped.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractableDependencyStoppedCallback);
+		DependencySubsystem->RemoveNode(this);
 	}
 
-	// Activation
+	if (IgnoredClassesLoadHandle.IsValid())
 	{
-		OnComponentActivated.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractableComponentActivated);
+		IgnoredClassesLoadHandle->CancelHandle();
+		IgnoredClassesLoadHandle.Reset();
 	}
 
-	// Bind Changing Input Devices
+	if (GetOwner() && GetOwner()->HasAuthority())
 	{
-		if (UMounteaInteractionSystemBFL::CanExecuteCosmeticEvents(GetWorld()))
+		if (AMounteaInteractionStateManager* StateManager = AMounteaInteractionStateManager::Get(this))
 		{
-			if (const auto localPlayer = UMounteaInteractionSystemBFL::FindLocalPlayer(GetOwner()))
-			{
-				if (UCommonInputSubsystem* commonInputSubsystem = UCommonInputSubsystem::Get(localPlayer))
-				{
-					commonInputSubsystem->OnInputMethodChangedNative.AddUObject(this, &UMounteaInteractableComponentBase::OnInputModeChanged);
-				}
-			}
+			StateManager->RemoveInteractable(this);
 		}
-		
-		OnInteractionDeviceChanged.AddUniqueDynamic(this, &UMounteaInteractableComponentBase::OnInputDeviceChanged);
 	}
-	
-	RemainingLifecycleCount = LifecycleCount;
-	
-	Execute_SetState(this, DefaultInteractableState);
 
-	if (bAutoActivate)
+	if (bOwnerNetDormant)
 	{
-		AutoSetup();
+		bOwnerNetDormant = false;
+		DEC_DWORD_STAT(STAT_MounteaDormantInteractables);
 	}
 
-#if WITH_EDITOR
-	
-	DrawDebug();
+	// This Interactable might have been the only one keeping Owner awake
+	if (GetOwner() && !GetOwner()->IsActorBeingDestroyed() && EndPlayReason == EEndPlayReason::Destroyed)
+	{
+		UpdateNetDormancyOf(GetOwner(), this);
+	}
 
-#endif
+	UMounteaInteractionRegistrySubsystem::ReleaseInteractableHandle(this);
+	InteractableHandle.Reset();
+	
+	Super::EndPlay(EndPlayReason);
 }
 
 void UMounteaInteractableComponentBase::InitWidget()
@@ -223,10 +377,23 @@ void UMounteaInteractableComponentBase::OnRegister()
 	}
 
 #endif
-	
+
 	Super::OnRegister();
 }
 
+void UMounteaInteractableComponentBase::Activate(bool bReset)
+{
+	const bool bWasActive = IsActive();
+	
+	Super::Activate(bReset);
+
+	// Replaces OnComponentActivated binding, so no dynamic delegate is bound per spawned Interactable
+	if (HasBegunPlay() && !bWasActive && IsActive())
+	{
+		InteractableComponentActivated(this, bReset);
+	}
+}
+
 #pragma region InteractionImplementations
 
 bool UMounteaInteractableComponentBase::DoesHaveInteractor_Implementation() const
@@ -239,11 +406,16 @@ bool UMounteaInteractableComponentBase::DoesAutoSetup_Implementation() const
 
 void UMounteaInteractableComponentBase::ToggleAutoSetup_Implementation(const ESetupType& NewValue)
 {
+	FlushOwnerNetDormancy();
+
 	SetupType = NewValue;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, SetupType, this);
 }
 
 bool UMounteaInteractableComponentBase::ActivateInteractable_Implementation(FString& ErrorMessage)
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("ActivateInteractable"));
+
 	const EInteractableStateV2 CachedState = InteractableState;
 
 	Execute_SetState(this, EInteractableStateV2::EIS_Active);
@@ -274,6 +446,8 @@ bool UMounteaInteractableComponentBase::ActivateInteractable_Implementation(FStr
 
 bool UMounteaInteractableComponentBase::WakeUpInteractable_Implementation(FString& ErrorMessage)
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("WakeUpInteractable"));
+
 	const EInteractableStateV2 CachedState = InteractableState;
 
 	Execute_SetState(this, EInteractableStateV2::EIS_Awake);
@@ -304,6 +478,8 @@ bool UMounteaInteractableComponentBase::WakeUpInteractable_Implementation(FStrin
 
 bool UMounteaInteractableComponentBase::CompleteInteractable_Implementation(FString& ErrorMessage)
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("CompleteInteractable"));
+
 	const EInteractableStateV2 CachedState = InteractableState;
 
 	Execute_SetState(this, EInteractableStateV2::EIS_Completed);
@@ -334,11 +510,15 @@ bool UMounteaInteractableComponentBase::CompleteInteractable_Implementation(FStr
 
 void UMounteaInteractableComponentBase::DeactivateInteractable_Implementation()
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("DeactivateInteractable"));
+
 	Execute_SetState(this, EInteractableStateV2::EIS_Disabled);
 }
 
 void UMounteaInteractableComponentBase::PauseInteraction_Implementation(const float ExpirationTime, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor)
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("PauseInteraction"));
+
 	if (!GetWorld()) return;
 	
 	Execute_SetState(this, EInteractableStateV2::EIS_Paused);
@@ -357,6 +537,8 @@ void UMounteaInteractableComponentBase::PauseInteraction_Implementation(const fl
 		
 		GetWorld()->GetTimerManager().SetTimer(Timer_ProgressExpiration, TimerDelegate_ProgressExpiration, ClampedExpiration, false);
 		GetWorld()->GetTimerManager().PauseTimer(Timer_Interaction);
+
+		UpdateReplicatedProgress();
 	}
 	else
 	{
@@ -424,6 +606,8 @@ EInteractableStateV2 UMounteaInteractableComponentBase::GetDefaultState_Implemen
 
 void UMounteaInteractableComponentBase::SetDefaultState_Implementation(const EInteractableStateV2 NewState)
 {
+	FlushOwnerNetDormancy();
+
 	if
 	(
 		DefaultInteractableState == EInteractableStateV2::EIS_Active ||
@@ -435,6 +619,10 @@ void UMounteaInteractableComponentBase::SetDefaultState_Implementation(const EIn
 		return;
 	}
 	DefaultInteractableState = NewState;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, DefaultInteractableState, this);
+
+	UpdateStateSnapshot(EMounteaInteractableSnapshotFlags::State);
+	UpdateOwnerNetDormancy();
 }
 
 EInteractableStateV2 UMounteaInteractableComponentBase::GetState_Implementation() const
@@ -443,14 +631,67 @@ EInteractableStateV2 UMounteaInteractableComponentBase::GetState_Implementation(
 void UMounteaInteractableComponentBase::CleanupComponent()
 {
 	Execute_StopHighlight(this);
-	OnInteractableStateChanged.Broadcast(InteractableState);
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractableStateChanged, OnInteractableStateChangedNative, OnInteractableStateChanged, InteractableState);
 	if (GetWorld()) GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
-	OnInteractorLost.Broadcast(Interactor);
+	UpdateReplicatedProgress();
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractorLost, OnInteractorLostNative, OnInteractorLost, Interactor);
 
 	Execute_RemoveHighlightableComponents(this, HighlightableComponents);
 	Execute_RemoveCollisionComponents(this, CollisionComponents);
 }
 
+void UMounteaInteractableComponentBase::ProcessStateTransition(const EInteractableStateV2 NewState, const EMounteaInteractableTransitionActions Actions)
+{
+	using EActions = EMounteaInteractableTransitionActions;
+
+	if (EnumHasAnyFlags(Actions, EActions::CancelInteraction))
+	{
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionCanceled, OnInteractionCanceledNative, OnInteractionCanceled);
+	}
+	if (EnumHasAnyFlags(Actions, EActions::ChangeState))
+	{
+		InteractableState = NewState;
+	}
+	if (EnumHasAnyFlags(Actions, EActions::StopHighlight))
+	{
+		Execute_StopHighlight(this);
+	}
+	if (EnumHasAnyFlags(Actions, EActions::BroadcastStateChanged))
+	{
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractableStateChanged, OnInteractableStateChangedNative, OnInteractableStateChanged, InteractableState);
+	}
+	if (EnumHasAnyFlags(Actions, EActions::ClearTimers) && GetWorld())
+	{
+		GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
+	}
+	if (EnumHasAnyFlags(Actions, EActions::LoseInteractor))
+	{
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractorLost, OnInteractorLostNative, OnInteractorLost, Interactor);
+	}
+	if (EnumHasAnyFlags(Actions, EActions::BindCollision))
+	{
+		for (const auto& Itr : CollisionComponents)
+		{
+			Execute_BindCollisionShape(this, Itr);
+		}
+	}
+	if (EnumHasAnyFlags(Actions, EActions::UnbindCollision))
+	{
+		for (const auto& Itr : CollisionComponents)
+		{
+			Execute_UnbindCollisionShape(this, Itr);
+		}
+	}
+	if (EnumHasAnyFlags(Actions, EActions::ClearCooldown) && GetWorld())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(Timer_Cooldown);
+	}
+	if (EnumHasAnyFlags(Actions, EActions::Cleanup))
+	{
+		CleanupComponent();
+	}
+}
+
 void UMounteaInteractableComponentBase::SetState_Implementation(const EInteractableStateV2 NewState)
 {
 	if (!GetOwner())
@@ -461,219 +702,29 @@ void UMounteaInteractableComponentBase::SetState_Implementation(const EInteracta
 
 	if (GetOwner()->HasAuthority())
 	{
-		switch (NewState)
+		const EInteractableStateV2 PreviousState = InteractableState;
+		const EMounteaInteractableTransitionActions Actions = MounteaInteractionStateMachine::InteractableTransitions.Get(PreviousState, NewState);
+
+		if (MounteaInteractionStateMachine::OnInteractableTransition().IsBound())
 		{
-			case EInteractableStateV2::EIS_Active:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Paused:
-					case EInteractableStateV2::EIS_Awake:
-						InteractableState = NewState;
-						OnInteractableStateChanged.Broadcast(InteractableState);
-						break;
-					case EInteractableStateV2::EIS_Active:
-						break;
-					case EInteractableStateV2::EIS_Asleep:
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::EIS_Cooldown:
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Disabled:
-					case EInteractableStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Awake:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Active:
-					case EInteractableStateV2::EIS_Asleep:
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::EIS_Cooldown:
-					case EInteractableStateV2::EIS_Disabled:
-					case EInteractableStateV2::EIS_Paused:
-						{
-							InteractableState = NewState;
-							OnInteractableStateChanged.Broadcast(InteractableState);
-							for (const auto& Itr : CollisionComponents)
-							{
-								Execute_BindCollisionShape(this, Itr);
-							}
-							break;
-						}
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::Default: 
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Asleep:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Active:
-					case EInteractableStateV2::EIS_Paused:
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::EIS_Cooldown:
-					case EInteractableStateV2::EIS_Disabled:
-						{
-							InteractableState = NewState;
-							Execute_StopHighlight(this);
-							OnInteractableStateChanged.Broadcast(InteractableState);
-							if (GetWorld()) GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
-							OnInteractorLost.Broadcast(Interactor);
-									
-							for (const auto& Itr : CollisionComponents)
-							{
-								Execute_UnbindCollisionShape(this, Itr);
-							}
-							break;
-						}
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Asleep:
-					case EInteractableStateV2::Default: 
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Cooldown:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::EIS_Active:
-						InteractableState = NewState;
-						Execute_StopHighlight(this);
-						OnInteractableStateChanged.Broadcast(InteractableState);
-						break;
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::EIS_Disabled:
-						{
-							InteractableState = NewState;
-							Execute_StopHighlight(this);
-							OnInteractableStateChanged.Broadcast(InteractableState);
-							if (GetWorld()) GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
-							OnInteractorLost.Broadcast(Interactor);
-									
-							for (const auto& Itr : CollisionComponents)
-							{
-								Execute_UnbindCollisionShape(this, Itr);
-							}
-							break;
-						}
-					case EInteractableStateV2::EIS_Paused:
-					case EInteractableStateV2::EIS_Cooldown:
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Asleep:
-					case EInteractableStateV2::Default: 
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Completed:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Active:
-						{
-							InteractableState = NewState;
-							CleanupComponent();
-							break;
-						}
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Paused:
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::EIS_Cooldown:
-					case EInteractableStateV2::EIS_Disabled:
-					case EInteractableStateV2::EIS_Asleep:
-					case EInteractableStateV2::Default: 
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Disabled:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Active:
-					case EInteractableStateV2::EIS_Paused:
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::EIS_Cooldown:
-					case EInteractableStateV2::EIS_Asleep:
-						{
-							InteractableState = NewState;
-
-							// Replacing Cleanup
-							Execute_StopHighlight(this);
-							OnInteractableStateChanged.Broadcast(InteractableState);
-							if (GetWorld()) GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
-							OnInteractorLost.Broadcast(Interactor);
-									
-							for (const auto& Itr : CollisionComponents)
-							{
-								Execute_UnbindCollisionShape(this, Itr);
-							}
+			MounteaInteractionStateMachine::OnInteractableTransition().Broadcast(this, PreviousState, NewState, Actions, MounteaInteractionStateMachine::GetTransitionCause());
+		}
 
-							break;
-						}
-					case EInteractableStateV2::EIS_Disabled:
-					case EInteractableStateV2::Default: 
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Suppressed:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Active:
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::EIS_Asleep:
-					case EInteractableStateV2::EIS_Disabled:
-					case EInteractableStateV2::EIS_Paused:
-						{
-							OnInteractionCanceled.Broadcast();
-							InteractableState = NewState;
-							Execute_StopHighlight(this);
-							OnInteractableStateChanged.Broadcast(InteractableState);
-							break;
-						}
-					case EInteractableStateV2::EIS_Cooldown:
-						{
-							OnInteractionCanceled.Broadcast();
-							InteractableState = NewState;
-							Execute_StopHighlight(this);
-							OnInteractableStateChanged.Broadcast(InteractableState);
-							GetWorld()->GetTimerManager().ClearTimer(Timer_Cooldown);
-							break;
-						}
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::EIS_Paused:
-				switch (InteractableState)
-				{
-					case EInteractableStateV2::EIS_Active:
-						{
-							InteractableState = NewState;
-							OnInteractableStateChanged.Broadcast(InteractableState);
-							break;
-						}
-					case EInteractableStateV2::EIS_Paused:
-					case EInteractableStateV2::EIS_Awake:
-					case EInteractableStateV2::EIS_Asleep:
-					case EInteractableStateV2::EIS_Disabled:
-					case EInteractableStateV2::EIS_Cooldown:
-					case EInteractableStateV2::EIS_Completed:
-					case EInteractableStateV2::EIS_Suppressed:
-					case EInteractableStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractableStateV2::Default: 
-			default:
-				Execute_StopHighlight(this);
-				break;
+		ProcessStateTransition(NewState, Actions);
+
+		// Flushed only once State has changed, so unchanged State never wakes Initially Dormant Owner
+		if (PreviousState != InteractableState)
+		{
+			FlushOwnerNetDormancy(true);
+			
+			MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractableState, this);
 		}
 	
-		Execute_ProcessDependencies(this);
+		RequestDependencyProcessing();
+
+		UpdateReplicatedProgress();
+		UpdateStateSnapshot();
+		UpdateOwnerNetDormancy();
 	}
 	else
 	{
@@ -689,10 +740,8 @@ void UMounteaInteractableComponentBase::StartHighlight_Implementation()
 		{
 			ProcessStartHighlight();
 		}
-		else
-		{
-			StartHighlight_Client();
-		}
+		
+		SetCosmeticState(EInteractableCosmeticState::ICS_Highlighted, true);
 	}
 	else
 	{
@@ -708,10 +757,8 @@ void UMounteaInteractableComponentBase::StopHighlight_Implementation()
 		{
 			ProcessStopHighlight();
 		}
-		else
-		{
-			StopHighlight_Client();
-		}
+		
+		SetCosmeticState(EInteractableCosmeticState::ICS_Highlighted, false);
 	}
 	else
 	{
@@ -727,6 +774,11 @@ void UMounteaInteractableComponentBase::SetIgnoredClasses_Implementation(const T
 	IgnoredClasses.Empty();
 
 	IgnoredClasses = NewIgnoredClasses;
+
+	if (HasBegunPlay())
+	{
+		ResolveIgnoredClasses();
+	}
 }
 
 void UMounteaInteractableComponentBase::AddIgnoredClass_Implementation(const TSoftClassPtr<UObject>& AddIgnoredClass)
@@ -737,18 +789,41 @@ void UMounteaInteractableComponentBase::AddIgnoredClass_Implementation(const TSo
 
 	IgnoredClasses.Add(AddIgnoredClass);
 
-	OnIgnoredInteractorClassAdded.Broadcast(AddIgnoredClass);
+	if (HasBegunPlay())
+	{
+		ResolveIgnoredClasses();
+	}
+
+	BroadcastEvent(&FMounteaInteractableEventHandlers::IgnoredInteractorClassAdded, OnIgnoredInteractorClassAddedNative, OnIgnoredInteractorClassAdded, AddIgnoredClass);
 }
 
 void UMounteaInteractableComponentBase::AddIgnoredClasses_Implementation(const TArray<TSoftClassPtr<UObject>>& AddIgnoredClasses)
 {
+	TArray<TSoftClassPtr<UObject>> AddedClasses;
 	for (const auto& Itr : AddIgnoredClasses)
 	{
-		Execute_AddIgnoredClass(this, Itr);
+		if (Itr == nullptr) continue;
+		if (IgnoredClasses.Contains(Itr)) continue;
+
+		IgnoredClasses.Add(Itr);
+		AddedClasses.Add(Itr);
 	}
-}
 
-void UMounteaInteractableComponentBase::RemoveIgnoredClass_Implementation(const TSoftClassPtr<UObject>& RemoveIgnoredClass)
+	if (AddedClasses.Num() == 0) return;
+
+	// Lookup is rebuilt once for the whole batch
+	if (HasBegunPlay())
+	{
+		ResolveIgnoredClasses();
+	}
+
+	for (const auto& Itr : AddedClasses)
+	{
+		BroadcastEvent(&FMounteaInteractableEventHandlers::IgnoredInteractorClassAdded, OnIgnoredInteractorClassAddedNative, OnIgnoredInteractorClassAdded, Itr);
+	}
+}
+
+void UMounteaInteractableComponentBase::RemoveIgnoredClass_Implementation(const TSoftClassPtr<UObject>& RemoveIgnoredClass)
 {
 	if (RemoveIgnoredClass == nullptr) return;
 
@@ -756,14 +831,36 @@ void UMounteaInteractableComponentBase::RemoveIgnoredClass_Implementation(const
 
 	IgnoredClasses.Remove(RemoveIgnoredClass);
 
-	OnIgnoredInteractorClassRemoved.Broadcast(RemoveIgnoredClass);
+	if (HasBegunPlay())
+	{
+		ResolveIgnoredClasses();
+	}
+
+	BroadcastEvent(&FMounteaInteractableEventHandlers::IgnoredInteractorClassRemoved, OnIgnoredInteractorClassRemovedNative, OnIgnoredInteractorClassRemoved, RemoveIgnoredClass);
 }
 
 void UMounteaInteractableComponentBase::RemoveIgnoredClasses_Implementation(const TArray<TSoftClassPtr<UObject>>& RemoveIgnoredClasses)
 {
+	TArray<TSoftClassPtr<UObject>> RemovedClasses;
 	for (const auto& Itr : RemoveIgnoredClasses)
 	{
-		Execute_RemoveIgnoredClass(this, Itr);
+		if (Itr == nullptr) continue;
+		if (IgnoredClasses.Remove(Itr) == 0) continue;
+
+		RemovedClasses.Add(Itr);
+	}
+
+	if (RemovedClasses.Num() == 0) return;
+
+	// Lookup is rebuilt once for the whole batch
+	if (HasBegunPlay())
+	{
+		ResolveIgnoredClasses();
+	}
+
+	for (const auto& Itr : RemovedClasses)
+	{
+		BroadcastEvent(&FMounteaInteractableEventHandlers::IgnoredInteractorClassRemoved, OnIgnoredInteractorClassRemovedNative, OnIgnoredInteractorClassRemoved, Itr);
 	}
 }
 
@@ -772,11 +869,18 @@ void UMounteaInteractableComponentBase::AddInteractionDependency_Implementation(
 	if (InteractionDependency.GetObject() == nullptr) return;
 	if (InteractionDependencies.Contains(InteractionDependency)) return;
 
-	OnInteractableDependencyChanged.Broadcast(InteractionDependency);
+	UMounteaInteractionDependencySubsystem* DependencySubsystem = UMounteaInteractionDependencySubsystem::Get(this);
+	if (DependencySubsystem && !DependencySubsystem->AddDependency(this, InteractionDependency.GetObject()))
+	{
+		LOG_ERROR(TEXT("[AddInteractionDependency] Dependency would create a cycle!"))
+		return;
+	}
+
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractableDependencyChanged, OnInteractableDependencyChangedNative, OnInteractableDependencyChanged, InteractionDependency);
 	
 	InteractionDependencies.Add(InteractionDependency);
 
-	InteractionDependency->GetInteractableDependencyStarted().Broadcast(this);
+	InteractionDependency->BroadcastInteractableDependencyStarted(this);
 }
 
 void UMounteaInteractableComponentBase::RemoveInteractionDependency_Implementation(const TScriptInterface<IMounteaInteractableInterface>& InteractionDependency)
@@ -784,11 +888,16 @@ void UMounteaInteractableComponentBase::RemoveInteractionDependency_Implementati
 	if (InteractionDependency.GetObject() == nullptr) return;
 	if (!InteractionDependencies.Contains(InteractionDependency)) return;
 
-	OnInteractableDependencyChanged.Broadcast(InteractionDependency);
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractableDependencyChanged, OnInteractableDependencyChangedNative, OnInteractableDependencyChanged, InteractionDependency);
 
 	InteractionDependencies.Remove(InteractionDependency);
 
-	InteractionDependency->GetInteractableDependencyStopped().Broadcast(this);
+	if (UMounteaInteractionDependencySubsystem* DependencySubsystem = UMounteaInteractionDependencySubsystem::Get(this))
+	{
+		DependencySubsystem->RemoveDependency(this, InteractionDependency.GetObject());
+	}
+
+	InteractionDependency->BroadcastInteractableDependencyStopped(this);
 }
 
 TArray<TScriptInterface<IMounteaInteractableInterface>> UMounteaInteractableComponentBase::GetInteractionDependencies_Implementation() const
@@ -796,6 +905,8 @@ TArray<TScriptInterface<IMounteaInteractableInterface>> UMounteaInteractableComp
 
 void UMounteaInteractableComponentBase::ProcessDependencies_Implementation()
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("ProcessDependencies"));
+
 	if (InteractionDependencies.Num() == 0) return;
 
 	auto Dependencies = InteractionDependencies;
@@ -805,7 +916,7 @@ void UMounteaInteractableComponentBase::ProcessDependencies_Implementation()
 		{
 			case EInteractableStateV2::EIS_Active:
 			case EInteractableStateV2::EIS_Suppressed:
-				Itr->GetInteractableDependencyStarted().Broadcast(this);
+				Itr->BroadcastInteractableDependencyStarted(this);
 				switch (Itr->Execute_GetState(Itr.GetObject()))
 				{
 					case EInteractableStateV2::EIS_Active:
@@ -828,7 +939,7 @@ void UMounteaInteractableComponentBase::ProcessDependencies_Implementation()
 			case EInteractableStateV2::EIS_Cooldown:
 			case EInteractableStateV2::EIS_Awake:
 			case EInteractableStateV2::EIS_Asleep:
-				Itr->GetInteractableDependencyStarted().Broadcast(this);
+				Itr->BroadcastInteractableDependencyStarted(this);
 				switch (Itr->Execute_GetState(Itr.GetObject()))
 				{
 					
@@ -847,7 +958,7 @@ void UMounteaInteractableComponentBase::ProcessDependencies_Implementation()
 				break;
 			case EInteractableStateV2::EIS_Disabled:
 			case EInteractableStateV2::EIS_Completed:
-				Itr->GetInteractableDependencyStopped().Broadcast(this);
+				Itr->BroadcastInteractableDependencyStopped(this);
 				Itr->Execute_SetState(this, Itr->Execute_GetDefaultState(Itr.GetObject()));
 				Execute_RemoveInteractionDependency(this, Itr);
 				break;
@@ -858,21 +969,38 @@ void UMounteaInteractableComponentBase::ProcessDependencies_Implementation()
 	}
 }
 
+void UMounteaInteractableComponentBase::RequestDependencyProcessing()
+{
+	UMounteaInteractionDependencySubsystem* DependencySubsystem = UMounteaInteractionDependencySubsystem::Get(this);
+	if (!DependencySubsystem || !DependencySubsystem->MarkDirty(this))
+	{
+		Execute_ProcessDependencies(this);
+	}
+}
+
 TScriptInterface<IMounteaInteractorInterface> UMounteaInteractableComponentBase::GetInteractor_Implementation() const
 { return Interactor; }
 
 void UMounteaInteractableComponentBase::SetInteractor_Implementation(const TScriptInterface<IMounteaInteractorInterface>& NewInteractor)
 {
+	FlushOwnerNetDormancy();
+
 	const TScriptInterface<IMounteaInteractorInterface> OldInteractor = Interactor;
 
 	Interactor = NewInteractor;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, Interactor, this);
+
+	if (GetOwner() && GetOwner()->HasAuthority() && OldInteractor.GetObject() && OldInteractor != NewInteractor)
+	{
+		ReleaseCosmeticStateOf(OldInteractor, NewInteractor);
+	}
 	
 	if (NewInteractor.GetInterface() != nullptr)
 	{
 		//NewInteractor->GetOnInteractableSelectedHandle().AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractableSelected);
 		//NewInteractor->GetOnInteractableFoundHandle().Broadcast(this);
 
-		NewInteractor->GetInputActionConsumedHandle().AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractorActionConsumed);
+		BindInteractorActionConsumed(NewInteractor);
 
 		if (GetOwner() && GetOwner()->HasAuthority())
 		{
@@ -884,7 +1012,7 @@ void UMounteaInteractableComponentBase::SetInteractor_Implementation(const TScri
 		if (OldInteractor.GetInterface() != nullptr)
 		{
 			//OldInteractor->GetOnInteractableSelectedHandle().RemoveDynamic(this, &UMounteaInteractableComponentBase::InteractableSelected);
-			OldInteractor->GetInputActionConsumedHandle().RemoveDynamic(this, &UMounteaInteractableComponentBase::InteractorActionConsumed);
+			UnbindInteractorActionConsumed(OldInteractor);
 		}
 
 		if (GetOwner() && GetOwner()->HasAuthority())
@@ -896,13 +1024,24 @@ void UMounteaInteractableComponentBase::SetInteractor_Implementation(const TScri
 	}
 
 	//Interactor = NewInteractor;
-	OnInteractorChanged.Broadcast(Interactor);
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractorChanged, OnInteractorChangedNative, OnInteractorChanged, Interactor);
+
+	UpdateOwnerNetDormancy();
 }
 
 float UMounteaInteractableComponentBase::GetInteractionProgress_Implementation() const
 {
 	if (!GetWorld()) return -1;
 
+	// Clients have no Interaction Timer, progress is extrapolated from replicated Server state
+	if (GetOwner() && !GetOwner()->HasAuthority())
+	{
+		const AGameStateBase* GameState = GetWorld()->GetGameState();
+		const float ServerTime = GameState ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+		
+		return ReplicatedProgress.GetProgress(ServerTime);
+	}
+
 	if (Timer_Interaction.IsValid())
 	{
 		return GetWorld()->GetTimerManager().GetTimerElapsed(Timer_Interaction) / InteractionPeriod;
@@ -915,6 +1054,8 @@ float UMounteaInteractableComponentBase::GetInteractionPeriod_Implementation() c
 
 void UMounteaInteractableComponentBase::SetInteractionPeriod_Implementation(const float NewPeriod)
 {
+	FlushOwnerNetDormancy();
+
 	float TempPeriod = NewPeriod;
 	if (TempPeriod > -1.f && TempPeriod < 0.01f)
 	{
@@ -926,6 +1067,7 @@ void UMounteaInteractableComponentBase::SetInteractionPeriod_Implementation(cons
 	}
 
 	InteractionPeriod = FMath::Max(-1.f, TempPeriod);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractionPeriod, this);
 }
 
 int32 UMounteaInteractableComponentBase::GetInteractableWeight_Implementation() const
@@ -933,9 +1075,12 @@ int32 UMounteaInteractableComponentBase::GetInteractableWeight_Implementation()
 
 void UMounteaInteractableComponentBase::SetInteractableWeight_Implementation(const int32 NewWeight)
 {
+	FlushOwnerNetDormancy();
+
 	InteractionWeight = NewWeight;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractionWeight, this);
 
-	OnInteractableWeightChanged.Broadcast(InteractionWeight);
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractableWeightChanged, OnInteractableWeightChangedNative, OnInteractableWeightChanged, InteractionWeight);
 }
 
 AActor* UMounteaInteractableComponentBase::GetInteractableOwner_Implementation() const
@@ -946,9 +1091,13 @@ ECollisionChannel UMounteaInteractableComponentBase::GetCollisionChannel_Impleme
 
 void UMounteaInteractableComponentBase::SetCollisionChannel_Implementation(const TEnumAsByte<ECollisionChannel>& NewChannel)
 {
+	FlushOwnerNetDormancy();
+
 	CollisionChannel = NewChannel;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, CollisionChannel, this);
+	InvalidateFilterKey();
 
-	OnInteractableCollisionChannelChanged.Broadcast(CollisionChannel);
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractableCollisionChannelChanged, OnInteractableCollisionChannelChangedNative, OnInteractableCollisionChannelChanged, CollisionChannel);
 }
 
 TArray<UPrimitiveComponent*> UMounteaInteractableComponentBase::GetCollisionComponents_Implementation() const
@@ -959,9 +1108,12 @@ EInteractableLifecycle UMounteaInteractableComponentBase::GetLifecycleMode_Imple
 
 void UMounteaInteractableComponentBase::SetLifecycleMode_Implementation(const EInteractableLifecycle& NewMode)
 {
+	FlushOwnerNetDormancy();
+
 	LifecycleMode = NewMode;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, LifecycleMode, this);
 
-	OnLifecycleModeChanged.Broadcast(LifecycleMode);
+	BroadcastEvent(&FMounteaInteractableEventHandlers::LifecycleModeChanged, OnLifecycleModeChangedNative, OnLifecycleModeChanged, LifecycleMode);
 }
 
 int32 UMounteaInteractableComponentBase::GetLifecycleCount_Implementation() const
@@ -969,29 +1121,36 @@ int32 UMounteaInteractableComponentBase::GetLifecycleCount_Implementation() cons
 
 void UMounteaInteractableComponentBase::SetLifecycleCount_Implementation(const int32 NewLifecycleCount)
 {
+	FlushOwnerNetDormancy();
+
 	switch (LifecycleMode)
 	{
 		case EInteractableLifecycle::EIL_Cycled:
 			if (NewLifecycleCount <= -1)
 			{
 				LifecycleCount = -1;
-				OnLifecycleCountChanged.Broadcast(LifecycleCount);
+				MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, LifecycleCount, this);
+				BroadcastEvent(&FMounteaInteractableEventHandlers::LifecycleCountChanged, OnLifecycleCountChangedNative, OnLifecycleCountChanged, LifecycleCount);
 			}
 			else if (NewLifecycleCount < 2)
 			{
 				LifecycleCount = 2;
-				OnLifecycleCountChanged.Broadcast(LifecycleCount);
+				MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, LifecycleCount, this);
+				BroadcastEvent(&FMounteaInteractableEventHandlers::LifecycleCountChanged, OnLifecycleCountChangedNative, OnLifecycleCountChanged, LifecycleCount);
 			}
 			else if (NewLifecycleCount > 2)
 			{
 				LifecycleCount = NewLifecycleCount;
-				OnLifecycleCountChanged.Broadcast(LifecycleCount);
+				MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, LifecycleCount, this);
+				BroadcastEvent(&FMounteaInteractableEventHandlers::LifecycleCountChanged, OnLifecycleCountChangedNative, OnLifecycleCountChanged, LifecycleCount);
 			}
 			break;
 		case EInteractableLifecycle::EIL_OnlyOnce:
 		case EInteractableLifecycle::Default:
 		default: break;
 	}
+
+	UpdateStateSnapshot(EMounteaInteractableSnapshotFlags::Lifecycle);
 }
 
 int32 UMounteaInteractableComponentBase::GetRemainingLifecycleCount_Implementation() const
@@ -1002,11 +1161,14 @@ float UMounteaInteractableComponentBase::GetCooldownPeriod_Implementation() cons
 
 void UMounteaInteractableComponentBase::SetCooldownPeriod_Implementation(const float NewCooldownPeriod)
 {
+	FlushOwnerNetDormancy();
+
 	switch (LifecycleMode)
 	{
 		case EInteractableLifecycle::EIL_Cycled:
 			CooldownPeriod = FMath::Max(0.1f, NewCooldownPeriod);
-			OnCooldownPeriodChanged.Broadcast(CooldownPeriod);
+			MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, CooldownPeriod, this);
+			BroadcastEvent(&FMounteaInteractableEventHandlers::CooldownPeriodChanged, OnCooldownPeriodChangedNative, OnCooldownPeriodChanged, CooldownPeriod);
 			break;
 		case EInteractableLifecycle::EIL_OnlyOnce:
 		case EInteractableLifecycle::Default:
@@ -1023,7 +1185,7 @@ void UMounteaInteractableComponentBase::AddCollisionComponent_Implementation(UPr
 	
 	Execute_BindCollisionShape(this, CollisionComp);
 	
-	OnCollisionComponentAdded.Broadcast(CollisionComp);
+	BroadcastEvent(&FMounteaInteractableEventHandlers::CollisionComponentAdded, OnCollisionComponentAddedNative, OnCollisionComponentAdded, CollisionComp);
 }
 
 void UMounteaInteractableComponentBase::AddCollisionComponents_Implementation(const TArray<UPrimitiveComponent*>& NewCollisionComponents)
@@ -1043,7 +1205,7 @@ void UMounteaInteractableComponentBase::RemoveCollisionComponent_Implementation(
 
 	Execute_UnbindCollisionShape(this, CollisionComp);
 	
-	OnCollisionComponentRemoved.Broadcast(CollisionComp);
+	BroadcastEvent(&FMounteaInteractableEventHandlers::CollisionComponentRemoved, OnCollisionComponentRemovedNative, OnCollisionComponentRemoved, CollisionComp);
 }
 
 void UMounteaInteractableComponentBase::RemoveCollisionComponents_Implementation(const TArray<UPrimitiveComponent*>& RemoveCollisionComponents)
@@ -1066,7 +1228,7 @@ void UMounteaInteractableComponentBase::AddHighlightableComponent_Implementation
 
 	Execute_BindHighlightableMesh(this, MeshComponent);
 
-	OnHighlightableComponentAdded.Broadcast(MeshComponent);
+	BroadcastEvent(&FMounteaInteractableEventHandlers::HighlightableComponentAdded, OnHighlightableComponentAddedNative, OnHighlightableComponentAdded, MeshComponent);
 }
 
 void UMounteaInteractableComponentBase::AddHighlightableComponents_Implementation(const TArray<UMeshComponent*>& AddMeshComponents)
@@ -1084,9 +1246,14 @@ void UMounteaInteractableComponentBase::RemoveHighlightableComponent_Implementat
 
 	HighlightableComponents.Remove(MeshComponent);
 
+	if (UMounteaHighlightSubsystem* HighlightSubsystem = UMounteaHighlightSubsystem::Get(this))
+	{
+		HighlightSubsystem->ClearHighlight(MeshComponent, this);
+	}
+
 	Execute_UnbindHighlightableMesh(this, MeshComponent);
 
-	OnHighlightableComponentRemoved.Broadcast(MeshComponent);
+	BroadcastEvent(&FMounteaInteractableEventHandlers::HighlightableComponentRemoved, OnHighlightableComponentRemovedNative, OnHighlightableComponentRemoved, MeshComponent);
 }
 
 void UMounteaInteractableComponentBase::RemoveHighlightableComponents_Implementation(const TArray<UMeshComponent*>& RemoveMeshComponents)
@@ -1107,7 +1274,14 @@ FDataTableRowHandle UMounteaInteractableComponentBase::GetInteractableData_Imple
 { return InteractableData; }
 
 void UMounteaInteractableComponentBase::SetInteractableData_Implementation(FDataTableRowHandle NewData)
-{ InteractableData = NewData; }
+{
+	FlushOwnerNetDormancy(true);
+
+	InteractableData = NewData;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractableData, this);
+
+	UpdateStateSnapshot(EMounteaInteractableSnapshotFlags::Data);
+}
 
 FText UMounteaInteractableComponentBase::GetInteractableName_Implementation() const
 { return InteractableName; }
@@ -1115,7 +1289,13 @@ FText UMounteaInteractableComponentBase::GetInteractableName_Implementation() co
 void UMounteaInteractableComponentBase::SetInteractableName_Implementation(const FText& NewName)
 {
 	if (NewName.IsEmpty()) return;
+	
+	FlushOwnerNetDormancy(true);
+	
 	InteractableName = NewName;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractableName, this);
+
+	UpdateStateSnapshot(EMounteaInteractableSnapshotFlags::Name);
 }
 
 EHighlightType UMounteaInteractableComponentBase::GetHighlightType_Implementation() const
@@ -1123,9 +1303,32 @@ EHighlightType UMounteaInteractableComponentBase::GetHighlightType_Implementatio
 
 void UMounteaInteractableComponentBase::SetHighlightType_Implementation(const EHighlightType NewHighlightType)
 {
+	FlushOwnerNetDormancy();
+
+	// Highlight applied locally or requested for owning Client is restored with new Highlight Type
+	const uint8 HighlightedFlag = static_cast<uint8>(EInteractableCosmeticState::ICS_Highlighted);
+	const bool bRestoreHighlight = HighlightType != NewHighlightType && ((AppliedCosmeticState | CosmeticState) & HighlightedFlag) != 0;
+	
+	if (HighlightType != NewHighlightType)
+	{
+		Execute_StopHighlight(this);
+	}
+	
 	HighlightType = NewHighlightType;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, HighlightType, this);
 
-	OnHighlightTypeChanged.Broadcast(NewHighlightType);
+	// Rebind so meshes are in the state new Highlight Type expects
+	for (const auto& Itr : HighlightableComponents)
+	{
+		Execute_BindHighlightableMesh(this, Itr);
+	}
+
+	if (bRestoreHighlight)
+	{
+		Execute_StartHighlight(this);
+	}
+
+	BroadcastEvent(&FMounteaInteractableEventHandlers::HighlightTypeChanged, OnHighlightTypeChangedNative, OnHighlightTypeChanged, NewHighlightType);
 }
 
 UMaterialInterface* UMounteaInteractableComponentBase::GetHighlightMaterial_Implementation() const
@@ -1133,9 +1336,12 @@ UMaterialInterface* UMounteaInteractableComponentBase::GetHighlightMaterial_Impl
 
 void UMounteaInteractableComponentBase::SetHighlightMaterial_Implementation(UMaterialInterface* NewHighlightMaterial)
 {
+	FlushOwnerNetDormancy();
+
 	HighlightMaterial = NewHighlightMaterial;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, HighlightMaterial, this);
 
-	OnHighlightMaterialChanged.Broadcast(NewHighlightMaterial);
+	BroadcastEvent(&FMounteaInteractableEventHandlers::HighlightMaterialChanged, OnHighlightMaterialChangedNative, OnHighlightMaterialChanged, NewHighlightMaterial);
 }
 
 ETimingComparison UMounteaInteractableComponentBase::GetComparisonMethod_Implementation() const
@@ -1146,9 +1352,12 @@ void UMounteaInteractableComponentBase::SetComparisonMethod_Implementation(const
 
 void UMounteaInteractableComponentBase::SetDefaults_Implementation()
 {
+	FlushOwnerNetDormancy();
+	
 	if (const auto DefaultTable = UMounteaInteractionFunctionLibrary::GetInteractableDefaultDataTable())
 	{
 		InteractableData.DataTable = DefaultTable;
+		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractableData, this);
 	}
 	
 	if (const auto DefaultWidgetClass = UMounteaInteractionFunctionLibrary::GetInteractableDefaultWidgetClass())
@@ -1174,7 +1383,19 @@ void UMounteaInteractableComponentBase::SetDefaults_Implementation()
 		InteractionWeight = defaultSettings.DefaultInteractableWeight;
 		if (!InteractableCompatibleTags.HasTag(defaultSettings.InteractableMainTag))
 			InteractableCompatibleTags.AddTag(defaultSettings.InteractableMainTag);
+
+		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, HighlightType, this);
+		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, HighlightMaterial, this);
+		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractionPeriod, this);
+		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractableState, this);
+		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, SetupType, this);
+		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, CollisionChannel, this);
+		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, CooldownPeriod, this);
+		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractionWeight, this);
+		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractableCompatibleTags, this);
 	}
+
+	InvalidateFilterKey();
 }
 
 FGameplayTagContainer UMounteaInteractableComponentBase::GetInteractableCompatibleTags_Implementation() const
@@ -1184,32 +1405,68 @@ FGameplayTagContainer UMounteaInteractableComponentBase::GetInteractableCompatib
 
 void UMounteaInteractableComponentBase::SetInteractableCompatibleTags_Implementation(const FGameplayTagContainer& Tags)
 {
+	FlushOwnerNetDormancy(true);
+
 	InteractableCompatibleTags = Tags;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractableCompatibleTags, this);
+	InvalidateFilterKey();
+
+	UpdateStateSnapshot(EMounteaInteractableSnapshotFlags::Tags);
 }
 
 void UMounteaInteractableComponentBase::AddInteractableCompatibleTag_Implementation(const FGameplayTag& Tag)
 {
+	FlushOwnerNetDormancy(true);
+
 	InteractableCompatibleTags.AddTag(Tag);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractableCompatibleTags, this);
+	InvalidateFilterKey();
+
+	UpdateStateSnapshot(EMounteaInteractableSnapshotFlags::Tags);
 }
 
 void UMounteaInteractableComponentBase::AddInteractableCompatibleTags_Implementation(const FGameplayTagContainer& Tags)
 {
+	FlushOwnerNetDormancy(true);
+
 	InteractableCompatibleTags.AppendTags(Tags);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractableCompatibleTags, this);
+	InvalidateFilterKey();
+
+	UpdateStateSnapshot(EMounteaInteractableSnapshotFlags::Tags);
 }
 
 void UMounteaInteractableComponentBase::RemoveInteractableCompatibleTag_Implementation(const FGameplayTag& Tag)
 {
+	FlushOwnerNetDormancy(true);
+
 	InteractableCompatibleTags.RemoveTag(Tag);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractableCompatibleTags, this);
+	InvalidateFilterKey();
+
+	UpdateStateSnapshot(EMounteaInteractableSnapshotFlags::Tags);
 }
 
 void UMounteaInteractableComponentBase::RemoveInteractableCompatibleTags_Implementation(const FGameplayTagContainer& Tags)
 {
+	FlushOwnerNetDormancy(true);
+
 	InteractableCompatibleTags.RemoveTags(Tags);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractableCompatibleTags, this);
+	InvalidateFilterKey();
+
+	UpdateStateSnapshot(EMounteaInteractableSnapshotFlags::Tags);
 }
 
 void UMounteaInteractableComponentBase::ClearInteractableCompatibleTags_Implementation()
 {
+	FlushOwnerNetDormancy(true);
+
 	InteractableCompatibleTags.Reset();
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractableCompatibleTags, this);
+	InvalidateFilterKey();
+
+	UpdateStateSnapshot(EMounteaInteractableSnapshotFlags::Tags);
 }
 
 bool UMounteaInteractableComponentBase::HasInteractor_Implementation() const
@@ -1271,24 +1528,17 @@ void UMounteaInteractableComponentBase::InteractorFound_Implementation(const TSc
 		{
 			Execute_SetInteractor(this, FoundInteractor);
 			
-			InteractorFound_Client(FoundInteractor);
-			ProcessToggleActive_Client(true);
+			SetCosmeticActive(true);
 		
 			Execute_OnInteractorFoundEvent(this, FoundInteractor);
 		}
 	}
 }
 
-void UMounteaInteractableComponentBase::InteractorFound_Client_Implementation(const TScriptInterface<IMounteaInteractorInterface>& DirtyInteractor)
-{
-	if (GetOwner() && !GetOwner()->HasAuthority())
-	{
-		OnInteractorFound.Broadcast(DirtyInteractor);
-	}
-}
-
 void UMounteaInteractableComponentBase::InteractorLost_Implementation(const TScriptInterface<IMounteaInteractorInterface>& LostInteractor)
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("InteractorLost"));
+
 	if (LostInteractor.GetInterface() == nullptr) return;
 
 	if (Interactor != LostInteractor)
@@ -1305,8 +1555,7 @@ void UMounteaInteractableComponentBase::InteractorLost_Implementation(const TScr
 		}
 		else
 		{
-			InteractorLost_Client(LostInteractor);
-			ProcessToggleActive_Client(false);
+			SetCosmeticActive(false);
 		}
 	}
 
@@ -1338,16 +1587,7 @@ void UMounteaInteractableComponentBase::InteractorLost_Implementation(const TScr
 	Execute_SetInteractor(this, nullptr);
 	Execute_OnInteractorLostEvent(this, LostInteractor);
 
-	OnInteractionCanceled.Broadcast();
-}
-
-void UMounteaInteractableComponentBase::InteractorLost_Client_Implementation(const TScriptInterface<IMounteaInteractorInterface>& DirtyInteractor)
-{
-	if (GetOwner() && !GetOwner()->HasAuthority())
-	{
-		OnInteractorLost.Broadcast(DirtyInteractor);
-		OnInteractionCanceled.Broadcast();
-	}
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionCanceled, OnInteractionCanceledNative, OnInteractionCanceled);
 }
 
 void UMounteaInteractableComponentBase::InteractionCompleted_Implementation(const float& TimeCompleted, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor)
@@ -1374,6 +1614,8 @@ void UMounteaInteractableComponentBase::InteractionCycleCompleted_Implementation
 
 void UMounteaInteractableComponentBase::InteractionStarted_Implementation(const float& TimeStarted, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor)
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("InteractionStarted"));
+
 	if (Execute_CanInteract(this) && GetOwner() && GetOwner()->HasAuthority())
 	{
 		GetWorld()->GetTimerManager().ClearTimer(Timer_ProgressExpiration);
@@ -1383,7 +1625,7 @@ void UMounteaInteractableComponentBase::InteractionStarted_Implementation(const
 
 		if (UMounteaInteractionSystemBFL::CanExecuteCosmeticEvents(GetWorld()))
 		{
-			Interactor->GetInputActionConsumedHandle().AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractorActionConsumed);
+			BindInteractorActionConsumed(Interactor);
 		}
 		else
 		{
@@ -1400,9 +1642,9 @@ void UMounteaInteractableComponentBase::InteractionStarted_Client_Implementation
 		if (Interactor != CausingInteractor)
 			Interactor = CausingInteractor;
 		
-		CausingInteractor->GetInputActionConsumedHandle().AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractorActionConsumed);
+		BindInteractorActionConsumed(CausingInteractor);
 		
-		OnInteractionStarted.Broadcast(TimeStarted, CausingInteractor);
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionStarted, OnInteractionStartedNative, OnInteractionStarted, TimeStarted, CausingInteractor);
 
 		if (bCanPersist && GetWorld()->GetTimerManager().IsTimerPaused(Timer_Interaction))
 		{
@@ -1467,12 +1709,14 @@ void UMounteaInteractableComponentBase::InteractionStopped_Client_Implementation
 		else
 			GetOwner()->GetWorldTimerManager().ClearTimer(Timer_Interaction);
 		
-		OnInteractionStopped.Broadcast(TimeStopped, CausingInteractor);
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionStopped, OnInteractionStoppedNative, OnInteractionStopped, TimeStopped, CausingInteractor);
 	}
 }
 
 void UMounteaInteractableComponentBase::InteractionCanceled_Implementation()
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("InteractionCanceled"));
+
 	if (GetOwner() && GetOwner()->HasAuthority())
 	{
 		if (Execute_CanInteract(this))
@@ -1514,12 +1758,14 @@ void UMounteaInteractableComponentBase::InteractionCancelled_Client_Implementati
 {
 	if (GetOwner() && !GetOwner()->HasAuthority())
 	{
-		OnInteractionCanceled.Broadcast();
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionCanceled, OnInteractionCanceledNative, OnInteractionCanceled);
 	}
 }
 
 void UMounteaInteractableComponentBase::InteractionLifecycleCompleted_Implementation()
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("InteractionLifecycleCompleted"));
+
 	Execute_SetState(this, EInteractableStateV2::EIS_Completed);
 
 	Execute_OnLifecycleCompletedEvent(this);
@@ -1527,23 +1773,25 @@ void UMounteaInteractableComponentBase::InteractionLifecycleCompleted_Implementa
 
 void UMounteaInteractableComponentBase::InteractionCooldownCompleted_Implementation()
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("InteractionCooldownCompleted"));
+
 	if (Interactor.GetInterface() != nullptr)
 	{		
 		if (Interactor->Execute_GetActiveInteractable(Interactor.GetObject()) == this)
 		{
-			ProcessToggleActive_Client(true);
+			SetCosmeticActive(true);
 			
 			Execute_SetState(this, EInteractableStateV2::EIS_Awake);
 		}
 		else
 		{
-			ProcessToggleActive_Client(false);
+			SetCosmeticActive(false);
 			Execute_SetState(this, DefaultInteractableState);
 		}
 	}
 	else
 	{
-		ProcessToggleActive_Client(false);
+		SetCosmeticActive(false);
 		Execute_SetState(this, DefaultInteractableState);
 	}
 	
@@ -1611,7 +1859,7 @@ void UMounteaInteractableComponentBase::InteractableSelected_Implementation(cons
  	if (Interactable == this)
  	{
  		Execute_SetState(this, EInteractableStateV2::EIS_Active);
- 		OnInteractableSelected.Broadcast(Interactable);
+ 		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractableSelected, OnInteractableSelectedNative, OnInteractableSelected, Interactable);
 
  		if (GetOwner() && GetOwner()->HasAuthority())
  		{
@@ -1621,7 +1869,7 @@ void UMounteaInteractableComponentBase::InteractableSelected_Implementation(cons
  			}
  			else
  			{
- 				ProcessToggleActive_Client(false);
+ 				SetCosmeticActive(false);
  			}
  		}
  	}
@@ -1635,14 +1883,14 @@ void UMounteaInteractableComponentBase::InteractableSelected_Implementation(cons
 			}
 			else
 			{
-				ProcessToggleActive_Client(false);
+				SetCosmeticActive(false);
 			}
 		}
 		
-		OnInteractionCanceled.Broadcast();
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionCanceled, OnInteractionCanceledNative, OnInteractionCanceled);
 		
 		Execute_SetState(this, DefaultInteractableState);
-		OnInteractorLost.Broadcast(Execute_GetInteractor(this));
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractorLost, OnInteractorLostNative, OnInteractorLost, Execute_GetInteractor(this));
 	}
 }
 
@@ -1670,59 +1918,90 @@ void UMounteaInteractableComponentBase::InteractableLost_Implementation(const TS
 			default: break;
 		}
 		
-		OnInteractorLost.Broadcast(Execute_GetInteractor(this));
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractorLost, OnInteractorLostNative, OnInteractorLost, Execute_GetInteractor(this));
 	}
 }
 
 void UMounteaInteractableComponentBase::FindAndAddCollisionShapes_Implementation()
 {
-	for (const auto& Itr : CollisionOverrides)
+	// Overrides found by name by the first Interactable of this Owner Class are resolved by name, the rest by tag
+	TArray<UPrimitiveComponent*> OverrideCollisions;
+	const FMounteaInteractableSetupTemplate* SetupTemplate = GetSetupTemplate();
+	if (!SetupTemplate || !SetupTemplate->Resolve(GetOwner(), SetupTemplate->CollisionOverrideComponents, OverrideCollisions))
 	{
-		if (const auto NewCollision = UMounteaInteractionSystemBFL::FindPrimitiveByName(Itr, GetOwner()))
-		{
-			Execute_AddCollisionComponent(this, NewCollision);
-			Execute_BindCollisionShape(this, NewCollision);
-		}
-		else
+		OverrideCollisions = UMounteaInteractionSystemBFL::FindPrimitivesByNameOrTag(CollisionOverrides, GetOwner());
+	}
+	else
+	{
+		for (int32 Index = 0; Index < CollisionOverrides.Num(); Index++)
 		{
-			if (const auto NewCollisionByTag = UMounteaInteractionSystemBFL::FindPrimitiveByTag(Itr, GetOwner()))
+			if (!OverrideCollisions[Index])
 			{
-				Execute_AddCollisionComponent(this, NewCollisionByTag);
-				Execute_BindCollisionShape(this, NewCollisionByTag);
+				OverrideCollisions[Index] = UMounteaInteractionSystemBFL::FindPrimitiveByTag(CollisionOverrides[Index], GetOwner());
 			}
-			else LOG_ERROR(TEXT("[Actor Interactable Component] Primitive Component '%s' not found!"), *Itr.ToString())
 		}
 	}
+	
+	for (int32 Index = 0; Index < CollisionOverrides.Num(); Index++)
+	{
+		const FName& Itr = CollisionOverrides[Index];
+		
+		if (UPrimitiveComponent* NewCollision = OverrideCollisions[Index])
+		{
+			Execute_AddCollisionComponent(this, NewCollision);
+			Execute_BindCollisionShape(this, NewCollision);
+		}
+		else LOG_ERROR(TEXT("[Actor Interactable Component] Primitive Component '%s' not found!"), *Itr.ToString())
+	}
 }
 
 void UMounteaInteractableComponentBase::FindAndAddHighlightableMeshes_Implementation()
 {
-	for (const auto& Itr : HighlightableOverrides)
+	// Overrides found by name by the first Interactable of this Owner Class are resolved by name, the rest by tag
+	TArray<UMeshComponent*> OverrideMeshes;
+	const FMounteaInteractableSetupTemplate* SetupTemplate = GetSetupTemplate();
+	if (!SetupTemplate || !SetupTemplate->Resolve(GetOwner(), SetupTemplate->HighlightableOverrideComponents, OverrideMeshes))
 	{
-		if (const auto NewMesh = UMounteaInteractionSystemBFL::FindMeshByName(Itr, GetOwner()))
+		OverrideMeshes = UMounteaInteractionSystemBFL::FindMeshesByNameOrTag(HighlightableOverrides, GetOwner());
+	}
+	else
+	{
+		for (int32 Index = 0; Index < HighlightableOverrides.Num(); Index++)
+		{
+			if (!OverrideMeshes[Index])
+			{
+				OverrideMeshes[Index] = UMounteaInteractionSystemBFL::FindMeshByTag(HighlightableOverrides[Index], GetOwner());
+			}
+		}
+	}
+	
+	for (int32 Index = 0; Index < HighlightableOverrides.Num(); Index++)
+	{
+		const FName& Itr = HighlightableOverrides[Index];
+		
+		if (UMeshComponent* NewMesh = OverrideMeshes[Index])
 		{
 			Execute_AddHighlightableComponent(this, NewMesh);
 			Execute_BindHighlightableMesh(this, NewMesh);
 		}
 		else
-		{
-			if (const auto NewHighlightByTag = UMounteaInteractionSystemBFL::FindMeshByTag(Itr, GetOwner()))
-			{
-				Execute_AddHighlightableComponent(this, NewHighlightByTag);
-				Execute_BindHighlightableMesh(this, NewHighlightByTag);
-			}
-			else
-				LOG_ERROR(TEXT("[Actor Interactable Component] Mesh Component '%s' not found!"), *Itr.ToString())
-		}
+			LOG_ERROR(TEXT("[Actor Interactable Component] Mesh Component '%s' not found!"), *Itr.ToString())
 	}
 }
 
 bool UMounteaInteractableComponentBase::TriggerCooldown_Implementation()
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("TriggerCooldown"));
+
 	if (LifecycleCount != -1)
 	{
+		FlushOwnerNetDormancy(true);
+		
 		const int32 TempRemainingLifecycleCount = RemainingLifecycleCount - 1;
 		RemainingLifecycleCount = FMath::Max(0, TempRemainingLifecycleCount);
+		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, RemainingLifecycleCount, this);
+
+		UpdateStateSnapshot();
 	}
 	
 	if (GetWorld())
@@ -1751,7 +2030,7 @@ bool UMounteaInteractableComponentBase::TriggerCooldown_Implementation()
 		}
 		*/
 
-		OnInteractionCycleCompleted.Broadcast(GetWorld()->GetTimeSeconds(), RemainingLifecycleCount, Execute_GetInteractor(this));
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionCycleCompleted, OnInteractionCycleCompletedNative, OnInteractionCycleCompleted, GetWorld()->GetTimeSeconds(), RemainingLifecycleCount, Execute_GetInteractor(this));
 		return true;
 	}
 
@@ -1769,20 +2048,15 @@ void UMounteaInteractableComponentBase::ToggleWidgetVisibility_Implementation(co
 			else
 				ProcessHideWidget();
 		}
-		else
-		{
-			if (IsVisible)
-				ShowWidget_Client();
-			else
-				HideWidget_Client();
-		}
+		
+		SetCosmeticState(EInteractableCosmeticState::ICS_WidgetVisible, IsVisible);
 	}
 	else
 	{
 		if (IsVisible)
-			ShowWidget_Client();
+			ProcessShowWidget();
 		else
-			HideWidget_Client();
+			ProcessHideWidget();
 	}
 }
 
@@ -1841,6 +2115,12 @@ void UMounteaInteractableComponentBase::BindHighlightableMesh_Implementation(UMe
 	if (!MeshComponent) return;
 	
 	MeshComponent->SetRenderCustomDepth(true);
+
+	// Persistent mode keeps the mesh in Custom Depth pass and highlights by Stencil only
+	if (HighlightType == EHighlightType::EHT_PersistentStencil && MeshComponent->CustomDepthStencilValue != StencilID)
+	{
+		MeshComponent->SetCustomDepthStencilValue(0);
+	}
 }
 
 void UMounteaInteractableComponentBase::UnbindHighlightableMesh_Implementation(UMeshComponent* MeshComponent) const
@@ -1869,10 +2149,17 @@ void UMounteaInteractableComponentBase::AutoSetup()
 				if (GetOwner() == nullptr) break;
 
 				TArray<UPrimitiveComponent*> OwnerPrimitives;
-				GetOwner()->GetComponents(OwnerPrimitives);
-
 				TArray<UMeshComponent*> OwnerMeshes;
-				GetOwner()->GetComponents(OwnerMeshes);
+
+				// Components found by the first Interactable of this Owner Class are resolved by name
+				const FMounteaInteractableSetupTemplate* SetupTemplate = GetSetupTemplate();
+				if (!SetupTemplate
+					|| !SetupTemplate->Resolve(GetOwner(), SetupTemplate->CollisionComponents, OwnerPrimitives)
+					|| !SetupTemplate->Resolve(GetOwner(), SetupTemplate->HighlightableComponents, OwnerMeshes))
+				{
+					GetOwner()->GetComponents(OwnerPrimitives);
+					GetOwner()->GetComponents(OwnerMeshes);
+				}
 
 				for (const auto& Itr : OwnerPrimitives)
 				{
@@ -1939,6 +2226,11 @@ void UMounteaInteractableComponentBase::AutoSetup()
 	Execute_FindAndAddHighlightableMeshes(this);
 }
 
+const FMounteaInteractableSetupTemplate* UMounteaInteractableComponentBase::GetSetupTemplate() const
+{
+	return FMounteaInteractableSetupTemplate::Get(GetOwner(), SetupType, CollisionOverrides, HighlightableOverrides);
+}
+
 void UMounteaInteractableComponentBase::OnCooldownCompletedCallback()
 {
 	if (!GetWorld())
@@ -1952,7 +2244,7 @@ void UMounteaInteractableComponentBase::OnCooldownCompletedCallback()
 		Execute_BindCollisionShape(this, Itr);
 	}
 	
-	OnCooldownCompleted.Broadcast();
+	BroadcastEvent(&FMounteaInteractableEventHandlers::CooldownCompleted, OnCooldownCompletedNative, OnCooldownCompleted);
 }
 
 bool UMounteaInteractableComponentBase::ValidateInteractable() const
@@ -2001,29 +2293,172 @@ void UMounteaInteractableComponentBase::InteractableDependencyStoppedCallback_Im
 	Execute_SetInteractableWeight(this, CachedInteractionWeight);
 }
 
-void UMounteaInteractableComponentBase::StartHighlight_Client_Implementation()
+void UMounteaInteractableComponentBase::SetCosmeticState(const EInteractableCosmeticState Flags, const bool bEnabled)
 {
-	ProcessStartHighlight();
+	if (!GetOwner() || !GetOwner()->HasAuthority()) return;
+
+	const uint8 NewCosmeticState = bEnabled ? (CosmeticState | static_cast<uint8>(Flags)) : (CosmeticState & ~static_cast<uint8>(Flags));
+	if (NewCosmeticState != CosmeticState)
+	{
+		FlushOwnerNetDormancy();
+		
+		CosmeticState = NewCosmeticState;
+		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, CosmeticState, this);
+	}
+
+	// Owner without remote connection is local, OnRep would never be called
+	if (UMounteaInteractionSystemBFL::CanExecuteCosmeticEvents(GetWorld()) && GetOwner()->GetNetConnection() == nullptr)
+	{
+		ApplyCosmeticState(CosmeticState);
+	}
 }
 
-void UMounteaInteractableComponentBase::StopHighlight_Client_Implementation()
+void UMounteaInteractableComponentBase::SetCosmeticActive(const bool bIsEnabled)
 {
-	ProcessStopHighlight();
+	SetCosmeticState(EInteractableCosmeticState::ICS_Active | EInteractableCosmeticState::ICS_Highlighted | EInteractableCosmeticState::ICS_WidgetVisible, bIsEnabled);
 }
 
-void UMounteaInteractableComponentBase::ProcessToggleActive_Client_Implementation(const bool bIsEnabled)
+void UMounteaInteractableComponentBase::ApplyCosmeticState(const uint8 TargetState)
 {
-	ProcessToggleActive(bIsEnabled);
+	const uint8 ActiveFlag = static_cast<uint8>(EInteractableCosmeticState::ICS_Active);
+	if ((TargetState ^ AppliedCosmeticState) & ActiveFlag)
+	{
+		const bool bIsActive = (TargetState & ActiveFlag) != 0;
+		AppliedCosmeticState = bIsActive ? (AppliedCosmeticState | ActiveFlag) : (AppliedCosmeticState & ~ActiveFlag);
+		
+		ProcessToggleActive(bIsActive);
+	}
+
+	// Process functions update applied state, so only what is still different is handled
+	const uint8 HighlightedFlag = static_cast<uint8>(EInteractableCosmeticState::ICS_Highlighted);
+	if ((TargetState ^ AppliedCosmeticState) & HighlightedFlag)
+	{
+		if (TargetState & HighlightedFlag)
+			ProcessStartHighlight();
+		else
+			ProcessStopHighlight();
+	}
+
+	const uint8 WidgetVisibleFlag = static_cast<uint8>(EInteractableCosmeticState::ICS_WidgetVisible);
+	if ((TargetState ^ AppliedCosmeticState) & WidgetVisibleFlag)
+	{
+		if (TargetState & WidgetVisibleFlag)
+			ProcessShowWidget();
+		else
+			ProcessHideWidget();
+	}
 }
 
-void UMounteaInteractableComponentBase::ShowWidget_Client_Implementation()
+void UMounteaInteractableComponentBase::OnRep_CosmeticState()
 {
-	ProcessShowWidget();
+	ApplyCosmeticState(CosmeticState);
 }
 
-void UMounteaInteractableComponentBase::HideWidget_Client_Implementation()
+void UMounteaInteractableComponentBase::ReleaseCosmeticState()
 {
-	ProcessHideWidget();
+	// Replicated value is kept for its new owning Connection, only what was applied here is reverted
+	if (GetOwner() && !GetOwner()->HasAuthority())
+	{
+		// Same value replicated again once owned again must still be applied
+		CosmeticState = 0;
+	}
+
+	ApplyCosmeticState(0);
+}
+
+void UMounteaInteractableComponentBase::ReleaseCosmeticStateOf(const TScriptInterface<IMounteaInteractorInterface>& OldInteractor, const TScriptInterface<IMounteaInteractorInterface>& NewInteractor) const
+{
+	UMounteaInteractorComponentBase* OldInteractorComponent = Cast<UMounteaInteractorComponentBase>(OldInteractor.GetObject());
+	if (!OldInteractorComponent || !OldInteractorComponent->GetOwner()) return;
+
+	// Cosmetic State is Owner only, so Connection losing ownership would never receive it cleared
+	const UNetConnection* OldConnection = OldInteractorComponent->GetOwner()->GetNetConnection();
+	const UObject* NewInteractorObject = NewInteractor.GetObject();
+	const AActor* NewOwningActor = NewInteractorObject ? IMounteaInteractorInterface::Execute_GetOwningActor(NewInteractorObject) : nullptr;
+	const UNetConnection* NewConnection = NewOwningActor ? NewOwningActor->GetNetConnection() : nullptr;
+
+	if (NewOwningActor && OldConnection == NewConnection) return;
+
+	OldInteractorComponent->ReleaseInteractableCosmetics_Client(FMounteaInteractableHandle::Get(this));
+}
+
+void UMounteaInteractableComponentBase::OnRep_FilterKeySource()
+{
+	InvalidateFilterKey();
+}
+
+const FMounteaInteractionFilterKey& UMounteaInteractableComponentBase::GetFilterKey() const
+{
+	if (bFilterKeyDirty)
+	{
+		FilterKey = FMounteaInteractionFilterKey::MakeInteractable(CollisionChannel, InteractableCompatibleTags);
+		bFilterKeyDirty = false;
+	}
+	return FilterKey;
+}
+
+bool UMounteaInteractableComponentBase::IsInteractorClassIgnored(const UClass* InteractorClass) const
+{
+	if (!InteractorClass || IgnoredClasses.Num() == 0) return false;
+
+	if (const bool* bFoundIgnored = IgnoredClassesLookup.Find(InteractorClass))
+	{
+		return *bFoundIgnored;
+	}
+
+	// Class loaded after lookup was rebuilt, ignored only if its parent is
+	const bool bIgnored = IsInteractorClassIgnored(InteractorClass->GetSuperClass());
+	IgnoredClassesLookup.Add(InteractorClass, bIgnored);
+	return bIgnored;
+}
+
+void UMounteaInteractableComponentBase::ResolveIgnoredClasses()
+{
+	if (IgnoredClassesLoadHandle.IsValid())
+	{
+		IgnoredClassesLoadHandle->CancelHandle();
+		IgnoredClassesLoadHandle.Reset();
+	}
+
+	RebuildIgnoredClassesLookup();
+
+	TArray<FSoftObjectPath> PendingClasses;
+	for (const TSoftClassPtr<UObject>& Itr : IgnoredClasses)
+	{
+		if (!Itr.IsNull() && !Itr.Get())
+		{
+			PendingClasses.Add(Itr.ToSoftObjectPath());
+		}
+	}
+
+	// Interactor Class cannot be loaded before its parents, so Classes still loading cannot be matched anyway
+	if (PendingClasses.Num() == 0 || !UAssetManager::IsInitialized()) return;
+
+	IgnoredClassesLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(PendingClasses), FStreamableDelegate::CreateWeakLambda(this, [this]()
+	{
+		RebuildIgnoredClassesLookup();
+	}));
+}
+
+void UMounteaInteractableComponentBase::RebuildIgnoredClassesLookup()
+{
+	IgnoredClassesLookup.Reset();
+
+	TArray<UClass*> DerivedClasses;
+	for (const TSoftClassPtr<UObject>& Itr : IgnoredClasses)
+	{
+		UClass* IgnoredClass = Itr.Get();
+		if (!IgnoredClass) continue;
+
+		IgnoredClassesLookup.Add(IgnoredClass, true);
+
+		DerivedClasses.Reset();
+		GetDerivedClasses(IgnoredClass, DerivedClasses);
+		for (const UClass* DerivedClass : DerivedClasses)
+		{
+			IgnoredClassesLookup.Add(DerivedClass, true);
+		}
+	}
 }
 
 void UMounteaInteractableComponentBase::OnRep_InteractableState()
@@ -2050,14 +2485,29 @@ void UMounteaInteractableComponentBase::OnRep_InteractableState()
 	}
 }
 
-void UMounteaInteractableComponentBase::OnRep_ActiveInteractor()
+void UMounteaInteractableComponentBase::OnRep_ActiveInteractor(const TScriptInterface<IMounteaInteractorInterface>& OldInteractor)
 {
+	// Found and Lost events are only broadcast on owning Client
+	if (bInteractorFoundBroadcast && OldInteractor.GetObject() != nullptr && OldInteractor != Interactor)
+	{
+		bInteractorFoundBroadcast = false;
+		
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractorLost, OnInteractorLostNative, OnInteractorLost, OldInteractor);
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionCanceled, OnInteractionCanceledNative, OnInteractionCanceled);
+	}
+	
 	if (Interactor.GetObject() == nullptr)
 	{
 		Execute_ToggleWidgetVisibility(this, false);
 
 		Execute_StopHighlight(this);
 	}
+	else if (!bInteractorFoundBroadcast && GetOwner() && GetOwner()->GetNetConnection() != nullptr)
+	{
+		bInteractorFoundBroadcast = true;
+		
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractorFound, OnInteractorFoundNative, OnInteractorFound, Interactor);
+	}
 }
 
 void UMounteaInteractableComponentBase::ProcessToggleActive(const bool bIsEnabled)
@@ -2076,7 +2526,37 @@ void UMounteaInteractableComponentBase::ProcessToggleActive(const bool bIsEnable
 
 void UMounteaInteractableComponentBase::ProcessStartHighlight()
 {
+	AppliedCosmeticState |= static_cast<uint8>(EInteractableCosmeticState::ICS_Highlighted);
+	
 	SetHiddenInGame(false, true);
+
+	UMounteaHighlightSubsystem* HighlightSubsystem = UMounteaHighlightSubsystem::Get(this);
+	
+	FMounteaHighlightRequest HighlightRequest;
+	HighlightRequest.Requester = this;
+	HighlightRequest.HighlightType = HighlightType;
+	HighlightRequest.bRenderCustomDepth = bInteractionHighlight;
+	HighlightRequest.StencilValue = (HighlightType == EHighlightType::EHT_PersistentStencil && !bInteractionHighlight) ? 0 : StencilID;
+	HighlightRequest.OverlayMaterial = HighlightMaterial;
+
+	// Batched path, net change is applied once per frame
+	if (HighlightSubsystem)
+	{
+		if (HighlightType == EHighlightType::EHT_OverlayMaterial && !HighlightProgressParameterName.IsNone())
+		{
+			HighlightSubsystem->StartProgressHighlight(this, HighlightableComponents, HighlightRequest, HighlightMaterialParameters, HighlightProgressParameterName);
+			return;
+		}
+
+		HighlightRequest.OverlayMaterial = HighlightSubsystem->GetSharedHighlightMaterial(HighlightMaterial, HighlightMaterialParameters);
+		
+		for (const auto& Itr : HighlightableComponents)
+		{
+			HighlightSubsystem->RequestHighlight(Itr, HighlightRequest);
+		}
+		return;
+	}
+	
 	switch (HighlightType)
 	{
 		case EHighlightType::EHT_PostProcessing:
@@ -2095,6 +2575,15 @@ void UMounteaInteractableComponentBase::ProcessStartHighlight()
 					Itr->SetOverlayMaterial(HighlightMaterial);
 				}
 			}
+			break;
+		case EHighlightType::EHT_PersistentStencil:
+			{
+				for (const auto& Itr : HighlightableComponents)
+				{
+					Itr->SetCustomDepthStencilValue(HighlightRequest.StencilValue);
+				}
+			}
+			break;
 		case EHighlightType::EHT_Default:
 		default:
 			break;
@@ -2103,10 +2592,26 @@ void UMounteaInteractableComponentBase::ProcessStartHighlight()
 
 void UMounteaInteractableComponentBase::ProcessStopHighlight()
 {
+	AppliedCosmeticState &= ~static_cast<uint8>(EInteractableCosmeticState::ICS_Highlighted);
+	
 	SetHiddenInGame(true, true);
+
+	// Batched path, net change is applied once per frame
+	if (UMounteaHighlightSubsystem* HighlightSubsystem = UMounteaHighlightSubsystem::Get(this))
+	{
+		HighlightSubsystem->StopProgressHighlight(this);
+		
+		for (const auto& Itr : HighlightableComponents)
+		{
+			HighlightSubsystem->ClearHighlight(Itr, this);
+		}
+		return;
+	}
+	
 	switch (HighlightType)
 	{
 		case EHighlightType::EHT_PostProcessing:
+		case EHighlightType::EHT_PersistentStencil:
 			{
 				for (const auto& Itr : HighlightableComponents)
 				{
@@ -2121,6 +2626,7 @@ void UMounteaInteractableComponentBase::ProcessStopHighlight()
 					Itr->SetOverlayMaterial(nullptr);
 				}
 			}
+			break;
 		case EHighlightType::EHT_Default:
 		default:
 			break;
@@ -2129,19 +2635,25 @@ void UMounteaInteractableComponentBase::ProcessStopHighlight()
 
 void UMounteaInteractableComponentBase::ProcessShowWidget()
 {
+	AppliedCosmeticState |= static_cast<uint8>(EInteractableCosmeticState::ICS_WidgetVisible);
+	
 	if (GetWidget())
 	{
+		BindInputModeChanged();
+		
 		UpdateInteractionWidget();
 
 		SetHiddenInGame(false);
 		SetVisibility(true);
 		
-		OnInteractableWidgetVisibilityChanged.Broadcast(true);
+		MounteaInteractionEvents::Broadcast(OnInteractableWidgetVisibilityChangedNative, OnInteractableWidgetVisibilityChanged, true);
 	}
 }
 
 void UMounteaInteractableComponentBase::ProcessHideWidget()
 {
+	AppliedCosmeticState &= ~static_cast<uint8>(EInteractableCosmeticState::ICS_WidgetVisible);
+	
 	if (GetWidget())
 	{
 		UpdateInteractionWidget();
@@ -2149,13 +2661,280 @@ void UMounteaInteractableComponentBase::ProcessHideWidget()
 		SetHiddenInGame(true);
 		SetVisibility(false);
 
-		OnInteractableWidgetVisibilityChanged.Broadcast(false);
+		MounteaInteractionEvents::Broadcast(OnInteractableWidgetVisibilityChangedNative, OnInteractableWidgetVisibilityChanged, false);
+	}
+}
+
+void UMounteaInteractableComponentBase::UpdateReplicatedProgress()
+{
+	if (!GetWorld() || !GetOwner() || !GetOwner()->HasAuthority()) return;
+
+	const FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	
+	FMounteaReplicatedProgress NewProgress;
+	if (TimerManager.IsTimerActive(Timer_Interaction))
+	{
+		NewProgress.Duration = TimerManager.GetTimerRate(Timer_Interaction);
+		NewProgress.StartServerTime = GetWorld()->GetTimeSeconds() - TimerManager.GetTimerElapsed(Timer_Interaction);
+	}
+	else if (TimerManager.IsTimerPaused(Timer_Interaction))
+	{
+		const float TimerRate = TimerManager.GetTimerRate(Timer_Interaction);
+		NewProgress.QuantizedProgress = FMounteaReplicatedProgress::QuantizeProgress(TimerRate > 0.f ? TimerManager.GetTimerElapsed(Timer_Interaction) / TimerRate : 0.f);
+	}
+
+	if (NewProgress == ReplicatedProgress) return;
+
+	FlushOwnerNetDormancy();
+	
+	ReplicatedProgress = NewProgress;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, ReplicatedProgress, this);
+}
+
+void UMounteaInteractableComponentBase::FlushOwnerNetDormancy(const bool bSnapshotValue) const
+{
+	// Designer set Net Dormancy is left untouched unless the feature is enabled
+	if (!GetDefault<UMounteaInteractionSystemSettings>()->IsInteractableNetDormancyEnabled()) return;
+	
+	// Sibling Interactable might have put Owner to dormancy as well, Awake Owner is not affected by flushing
+	AActor* OwningActor = GetOwner();
+	if (!OwningActor || !OwningActor->HasAuthority()) return;
+
+	// Flushing turns Initially Dormant Owner to DormantAll and sends its initial bunch to every Client, State Manager carries the value instead
+	if (bSnapshotValue && OwningActor->NetDormancy == DORM_Initial && OwningActor->IsNetStartupActor() && AMounteaInteractionStateManager::Get(OwningActor) != nullptr) return;
+
+	OwningActor->FlushNetDormancy();
+}
+
+void UMounteaInteractableComponentBase::UpdateOwnerNetDormancy()
+{
+	UpdateNetDormancyOf(GetOwner(), nullptr);
+}
+
+bool UMounteaInteractableComponentBase::IsIdleForNetDormancy(const bool bStateManaged) const
+{
+	// State is replicated by Interaction State Manager, so only Interactor needs Owner awake
+	return (bStateManaged || InteractableState == DefaultInteractableState) && !Execute_HasInteractor(this);
+}
+
+void UMounteaInteractableComponentBase::UpdateNetDormancyOf(AActor* OwningActor, const UMounteaInteractableComponentBase* ExcludedInteractable)
+{
+	if (!OwningActor || !OwningActor->HasAuthority() || OwningActor->GetNetMode() == NM_Standalone) return;
+
+	if (!GetDefault<UMounteaInteractionSystemSettings>()->IsInteractableNetDormancyEnabled()) return;
+
+	TInlineComponentArray<UMounteaInteractableComponentBase*> Interactables(OwningActor);
+	Interactables.Remove(const_cast<UMounteaInteractableComponentBase*>(ExcludedInteractable));
+
+	// Owner set to never go dormant is left untouched
+	if (Interactables.Num() == 0 || OwningActor->NetDormancy == DORM_Never) return;
+
+	// Owner replicating state of its own is opted out by any of its Interactables
+	for (const UMounteaInteractableComponentBase* Itr : Interactables)
+	{
+		if (!Itr->bManageOwnerNetDormancy) return;
+	}
+
+	// Dormancy affects whole Owner, so it is dormant only once all of its Interactables are idle
+	const bool bStateManaged = AMounteaInteractionStateManager::Get(OwningActor) != nullptr;
+	bool bShouldBeDormant = true;
+	for (const UMounteaInteractableComponentBase* Itr : Interactables)
+	{
+		if (!Itr->IsIdleForNetDormancy(bStateManaged))
+		{
+			bShouldBeDormant = false;
+			break;
+		}
+	}
+
+	// Startup Owners which have never woken up are not sent to joining Clients at all, so they are kept Initially Dormant until needed
+	if (bStateManaged && OwningActor->NetDormancy == DORM_Initial && OwningActor->IsNetStartupActor())
+	{
+		if (!bShouldBeDormant)
+		{
+			OwningActor->SetNetDormancy(DORM_Awake);
+		}
+		return;
+	}
+
+	for (UMounteaInteractableComponentBase* Itr : Interactables)
+	{
+		if (bShouldBeDormant == static_cast<bool>(Itr->bOwnerNetDormant)) continue;
+
+		Itr->bOwnerNetDormant = bShouldBeDormant;
+		if (bShouldBeDormant)
+		{
+			INC_DWORD_STAT(STAT_MounteaDormantInteractables);
+		}
+		else
+		{
+			DEC_DWORD_STAT(STAT_MounteaDormantInteractables);
+		}
+	}
+
+	const ENetDormancy NewDormancy = bShouldBeDormant ? DORM_DormantAll : DORM_Awake;
+	if (OwningActor->NetDormancy != NewDormancy)
+	{
+		OwningActor->SetNetDormancy(NewDormancy);
+	}
+}
+
+FMounteaInteractableStateSnapshot UMounteaInteractableComponentBase::BuildStateSnapshot() const
+{
+	FMounteaInteractableStateSnapshot Snapshot;
+
+	EMounteaInteractableSnapshotFlags Flags = static_cast<EMounteaInteractableSnapshotFlags>(StateSnapshotOverrides);
+	if (InteractableState != DefaultInteractableState)
+	{
+		EnumAddFlags(Flags, EMounteaInteractableSnapshotFlags::State);
+	}
+	if (RemainingLifecycleCount != LifecycleCount)
+	{
+		EnumAddFlags(Flags, EMounteaInteractableSnapshotFlags::Lifecycle);
+	}
+
+	Snapshot.Flags = static_cast<uint8>(Flags);
+	Snapshot.State = InteractableState;
+	Snapshot.RemainingLifecycleCount = RemainingLifecycleCount;
+
+	if (Snapshot.HasFlag(EMounteaInteractableSnapshotFlags::Data))
+		Snapshot.InteractableData = InteractableData;
+	if (Snapshot.HasFlag(EMounteaInteractableSnapshotFlags::Name))
+		Snapshot.InteractableName = InteractableName;
+	if (Snapshot.HasFlag(EMounteaInteractableSnapshotFlags::Tags))
+		Snapshot.InteractableCompatibleTags = InteractableCompatibleTags;
+
+	return Snapshot;
+}
+
+void UMounteaInteractableComponentBase::ApplyStateSnapshot(const FMounteaInteractableStateSnapshot& Snapshot)
+{
+	if (!GetOwner() || GetOwner()->HasAuthority()) return;
+
+	if (!HasBegunPlay())
+	{
+		PendingStateSnapshot = Snapshot;
+		bHasPendingStateSnapshot = true;
+		return;
+	}
+
+	// Changed values notify the same way their replication does, values shown by Widget refresh it
+	bool bWidgetValuesChanged = false;
+	
+	const EInteractableStateV2 NewState = Snapshot.HasFlag(EMounteaInteractableSnapshotFlags::State) ? Snapshot.State : DefaultInteractableState;
+	const int32 NewRemainingLifecycleCount = Snapshot.HasFlag(EMounteaInteractableSnapshotFlags::Lifecycle) ? Snapshot.RemainingLifecycleCount : LifecycleCount;
+	if (NewRemainingLifecycleCount != RemainingLifecycleCount)
+	{
+		RemainingLifecycleCount = NewRemainingLifecycleCount;
+		bWidgetValuesChanged = true;
+	}
+
+	if (Snapshot.HasFlag(EMounteaInteractableSnapshotFlags::Data) && !(Snapshot.InteractableData == InteractableData))
+	{
+		InteractableData = Snapshot.InteractableData;
+		bWidgetValuesChanged = true;
+	}
+	if (Snapshot.HasFlag(EMounteaInteractableSnapshotFlags::Name) && !Snapshot.InteractableName.IdenticalTo(InteractableName))
+	{
+		InteractableName = Snapshot.InteractableName;
+		bWidgetValuesChanged = true;
+	}
+	if (Snapshot.HasFlag(EMounteaInteractableSnapshotFlags::Tags) && Snapshot.InteractableCompatibleTags != InteractableCompatibleTags)
+	{
+		InteractableCompatibleTags = Snapshot.InteractableCompatibleTags;
+		OnRep_FilterKeySource();
+	}
+
+	if (NewState != InteractableState)
+	{
+		InteractableState = NewState;
+		OnRep_InteractableState();
+	}
+
+	if (bWidgetValuesChanged)
+	{
+		UpdateInteractionWidget();
+	}
+}
+
+FMounteaInteractableHandle UMounteaInteractableComponentBase::GetInteractableHandle() const
+{
+	if (!InteractableHandle.IsValid())
+	{
+		InteractableHandle = UMounteaInteractionRegistrySubsystem::AcquireInteractableHandle(this);
+	}
+	return InteractableHandle;
+}
+
+void UMounteaInteractableComponentBase::UpdateStateSnapshot(const EMounteaInteractableSnapshotFlags ChangedOverrides)
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority()) return;
+
+	StateSnapshotOverrides |= static_cast<uint8>(ChangedOverrides);
+
+	if (AMounteaInteractionStateManager* StateManager = AMounteaInteractionStateManager::Get(this))
+	{
+		StateManager->UpdateInteractable(this, BuildStateSnapshot());
 	}
 }
 
 void UMounteaInteractableComponentBase::InteractorActionConsumed(UInputAction* ConsumedAction)
 {
-	OnInputActionConsumed.Broadcast(ConsumedAction);
+	MounteaInteractionEvents::Broadcast(OnInputActionConsumedNative, OnInputActionConsumed, ConsumedAction);
+}
+
+void UMounteaInteractableComponentBase::BindInteractorActionConsumed(const TScriptInterface<IMounteaInteractorInterface>& InInteractor)
+{
+	if (InInteractor.GetInterface() == nullptr) return;
+
+	if (FInputActionConsumedNative* NativeHandle = InInteractor->GetInputActionConsumedNativeHandle())
+	{
+		if (!NativeHandle->IsBoundToObject(this))
+		{
+			NativeHandle->AddUObject(this, &UMounteaInteractableComponentBase::InteractorActionConsumed);
+		}
+	}
+	else
+	{
+		InInteractor->GetInputActionConsumedHandle().AddUniqueDynamic(this, &UMounteaInteractableComponentBase::InteractorActionConsumed);
+	}
+}
+
+void UMounteaInteractableComponentBase::UnbindInteractorActionConsumed(const TScriptInterface<IMounteaInteractorInterface>& InInteractor)
+{
+	if (InInteractor.GetInterface() == nullptr) return;
+
+	if (FInputActionConsumedNative* NativeHandle = InInteractor->GetInputActionConsumedNativeHandle())
+	{
+		NativeHandle->RemoveAll(this);
+	}
+	else
+	{
+		InInteractor->GetInputActionConsumedHandle().RemoveDynamic(this, &UMounteaInteractableComponentBase::InteractorActionConsumed);
+	}
+}
+
+void UMounteaInteractableComponentBase::BindInputModeChanged()
+{
+	// Subscribed lazily, only Interactables which ever show their Widget need to know about Input Device
+	if (bInputModeChangedBound)
+	{
+		return;
+	}
+
+	if (!UMounteaInteractionSystemBFL::CanExecuteCosmeticEvents(GetWorld()))
+	{
+		return;
+	}
+	
+	if (const auto localPlayer = UMounteaInteractionSystemBFL::FindLocalPlayer(GetOwner()))
+	{
+		if (UCommonInputSubsystem* commonInputSubsystem = UCommonInputSubsystem::Get(localPlayer))
+		{
+			commonInputSubsystem->OnInputMethodChangedNative.AddUObject(this, &UMounteaInteractableComponentBase::OnInputModeChanged);
+			bInputModeChangedBound = true;
+		}
+	}
 }
 
 void UMounteaInteractableComponentBase::OnInputModeChanged(ECommonInputType CommonInput)
@@ -2175,7 +2954,7 @@ void UMounteaInteractableComponentBase::OnInputModeChanged(ECommonInputType Comm
 				const auto currentInputType = commonInputSubsystem->GetCurrentInputType();
 				const auto currentInputName = commonInputSubsystem->GetCurrentGamepadName();
 				
-				OnInteractionDeviceChanged.Broadcast(currentInputType, currentInputName);
+				BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionDeviceChanged, OnInteractionDeviceChangedNative, OnInteractionDeviceChanged, currentInputType, currentInputName);
 			}
 		}
 	}
@@ -2459,25 +3238,39 @@ void UMounteaInteractableComponentBase::GetLifetimeReplicatedProps(TArray<FLifet
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, InteractionPeriod,						COND_SimulatedOnly);
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, DefaultInteractableState,			COND_SimulatedOnly);
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, SetupType,									COND_SimulatedOnly);	
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, CooldownPeriod,						COND_SimulatedOnly);
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, InteractableCompatibleTags,		COND_SimulatedOnly);
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, HighlightType,								COND_SimulatedOnly);
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, HighlightMaterial,						COND_SimulatedOnly);
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, InteractableName,						COND_SimulatedOnly);
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, LifecycleMode,							COND_SimulatedOnly);
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, LifecycleCount,							COND_SimulatedOnly);
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, RemainingLifecycleCount,			COND_SimulatedOnly);
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, InteractionWeight,						COND_SimulatedOnly);
-
-	//DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, Timer_Interaction,						COND_SimulatedOnly);
-
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, Interactor,									COND_None);	
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, InteractableState,						COND_None);	
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, InteractableData,						COND_None);
-	DOREPLIFETIME_CONDITION(UMounteaInteractableComponentBase, CollisionChannel,						COND_None);
+	FDoRepLifetimeParams SimulatedOnlyParams;
+	SimulatedOnlyParams.Condition = COND_SimulatedOnly;
+	SimulatedOnlyParams.bIsPushBased = true;
+
+	FDoRepLifetimeParams AlwaysParams;
+	AlwaysParams.Condition = COND_None;
+	AlwaysParams.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, InteractionPeriod,						SimulatedOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, DefaultInteractableState,			SimulatedOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, SetupType,									SimulatedOnlyParams);	
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, CooldownPeriod,						SimulatedOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, InteractableCompatibleTags,		SimulatedOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, HighlightType,								SimulatedOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, HighlightMaterial,						SimulatedOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, InteractableName,						SimulatedOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, LifecycleMode,							SimulatedOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, LifecycleCount,							SimulatedOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, RemainingLifecycleCount,			SimulatedOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, InteractionWeight,						SimulatedOnlyParams);
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, ReplicatedProgress,					AlwaysParams);
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, Interactor,									AlwaysParams);	
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, InteractableState,						AlwaysParams);	
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, InteractableData,						AlwaysParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, CollisionChannel,						AlwaysParams);
+
+	FDoRepLifetimeParams OwnerOnlyParams;
+	OwnerOnlyParams.Condition = COND_OwnerOnly;
+	OwnerOnlyParams.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMounteaInteractableComponentBase, CosmeticState,						OwnerOnlyParams);
 }
 
 #undef LOCTEXT_NAMES
\ No newline at end of file
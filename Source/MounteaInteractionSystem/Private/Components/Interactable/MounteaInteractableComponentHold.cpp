@@ -60,7 +60,7 @@ void UMounteaInteractableComponentHold::OnInteractionCompletedCallback()
 		if (!GetWorld())
 		{
 			LOG_WARNING(TEXT("[OnInteractionCompletedCallback] No World, this is bad!"))
-			OnInteractionCanceled.Broadcast();
+			BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionCanceled, OnInteractionCanceledNative, OnInteractionCanceled);
 			return;
 		}
 
@@ -70,7 +70,7 @@ void UMounteaInteractableComponentHold::OnInteractionCompletedCallback()
 		}
 		else
 		{
-			ProcessToggleActive_Client(false);
+			SetCosmeticActive(false);
 		}
 		
 		if (LifecycleMode == EInteractableLifecycle::EIL_Cycled)
@@ -78,7 +78,7 @@ void UMounteaInteractableComponentHold::OnInteractionCompletedCallback()
 			if (Execute_TriggerCooldown(this)) return;
 		}
 	
-		OnInteractionCompleted.Broadcast(GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionCompleted, OnInteractionCompletedNative, OnInteractionCompleted, GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
 	}
 }
 
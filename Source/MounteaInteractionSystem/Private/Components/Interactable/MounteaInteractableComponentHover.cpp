@@ -14,13 +14,18 @@ UMounteaInteractableComponentHover::UMounteaInteractableComponentHover()
 	InteractableName = NSLOCTEXT("MounteaInteractableComponentHover", "Hover", "Hover");
 }
 
-void UMounteaInteractableComponentHover::BeginPlay()
+const FMounteaInteractableEventHandlers& UMounteaInteractableComponentHover::GetEventHandlers() const
 {
-	Super::BeginPlay();
+	// Hover is driven by Cursor, not by Overlaps
+	static const FMounteaInteractableEventHandlers HoverHandlers = []
+	{
+		FMounteaInteractableEventHandlers Handlers = GetDefaultEventHandlers();
+		Handlers.InteractorOverlapped = nullptr;
+		Handlers.InteractorStopOverlap = nullptr;
+		return Handlers;
+	}();
 
-	OnInteractorOverlapped.										RemoveDynamic(this, &UMounteaInteractableComponentHover::OnInteractableBeginOverlapEvent);
-	OnInteractorStopOverlap.										RemoveDynamic(this, &UMounteaInteractableComponentHover::OnInteractableStopOverlapEvent);
-	OnInteractorTraced.												RemoveDynamic(this, &UMounteaInteractableComponentHover::OnInteractableTracedEvent);
+	return HoverHandlers;
 }
 
 void UMounteaInteractableComponentHover::BindCollisionShape_Implementation(UPrimitiveComponent* PrimitiveComponent) const
@@ -53,13 +58,13 @@ bool UMounteaInteractableComponentHover::CanInteract_Implementation() const
 void UMounteaInteractableComponentHover::OnHoverBeginsEvent(UPrimitiveComponent* PrimitiveComponent)
 {
 	OverlappingComponent = PrimitiveComponent;
-	OnCursorBeginsOverlap.Broadcast(PrimitiveComponent);
+	MounteaInteractionEvents::Broadcast(OnCursorBeginsOverlapNative, OnCursorBeginsOverlap, PrimitiveComponent);
 }
 
 void UMounteaInteractableComponentHover::OnHoverStopsEvent(UPrimitiveComponent* PrimitiveComponent)
 {
 	OverlappingComponent = nullptr;
-	OnCursorStopsOverlap.Broadcast(PrimitiveComponent);
+	MounteaInteractionEvents::Broadcast(OnCursorStopsOverlapNative, OnCursorStopsOverlap, PrimitiveComponent);
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -19,14 +19,6 @@ UMounteaInteractableComponentMash::UMounteaInteractableComponentMash() :
 	InteractableName = NSLOCTEXT("MounteaInteractableComponentMash", "Mash", "Mash");
 }
 
-void UMounteaInteractableComponentMash::BeginPlay()
-{
-	Super::BeginPlay();
-
-	OnInteractionFailed.		AddUniqueDynamic(this, &UMounteaInteractableComponentMash::InteractionFailed);
-	OnKeyMashed.				AddUniqueDynamic(this, &UMounteaInteractableComponentMash::OnKeyMashedEvent);
-}
-
 void UMounteaInteractableComponentMash::InteractionFailed()
 {
 	Execute_SetState(this, Execute_GetDefaultState(this));
@@ -38,7 +30,8 @@ void UMounteaInteractableComponentMash::InteractionFailed()
 
 void UMounteaInteractableComponentMash::OnInteractionFailedCallback()
 {
-	OnInteractionFailed.Broadcast();
+	InteractionFailed();
+	MounteaInteractionEvents::Broadcast(OnInteractionFailedNative, OnInteractionFailed);
 }
 
 void UMounteaInteractableComponentMash::OnInteractionCompletedCallback()
@@ -57,11 +50,12 @@ void UMounteaInteractableComponentMash::OnInteractionCompletedCallback()
 	
 	if (ActualMashAmount >= MinMashAmountRequired)
 	{
-		OnInteractionCompleted.Broadcast(GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionCompleted, OnInteractionCompletedNative, OnInteractionCompleted, GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
 	}
 	else
 	{
-		OnInteractionFailed.Broadcast();
+		InteractionFailed();
+		MounteaInteractionEvents::Broadcast(OnInteractionFailedNative, OnInteractionFailed);
 	}
 
 	CleanupComponent();
@@ -71,13 +65,15 @@ void UMounteaInteractableComponentMash::CleanupComponent()
 {
 	ActualMashAmount = 0;
 	
-	OnInteractableStateChanged.Broadcast(InteractableState);
+	BroadcastEvent(&FMounteaInteractableEventHandlers::InteractableStateChanged, OnInteractableStateChangedNative, OnInteractableStateChanged, InteractableState);
 	
 	if (GetWorld())
 	{
 		GetWorld()->GetTimerManager().ClearTimer(TimerHandle_Mashed);
 		GetWorld()->GetTimerManager().ClearTimer(Timer_Interaction);
 	}
+
+	UpdateReplicatedProgress();
 }
 
 void UMounteaInteractableComponentMash::InteractionStarted_Implementation(const float& TimeStarted, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor)
@@ -118,9 +114,12 @@ void UMounteaInteractableComponentMash::InteractionStarted_Implementation(const
 			false
 		);
 		
+		UpdateReplicatedProgress();
+		
 		ActualMashAmount++;
 
-		OnKeyMashed.Broadcast();
+		OnKeyMashedEvent();
+		MounteaInteractionEvents::Broadcast(OnKeyMashedNative, OnKeyMashed);
 	}
 }
 
@@ -10,6 +10,8 @@
 
 #endif
 
+#include "Net/Core/PushModel/PushModel.h"
+
 #define LOCTEXT_NAMESPACE "MounteaInteractableComponentPress"
 
 UMounteaInteractableComponentPress::UMounteaInteractableComponentPress()
@@ -40,7 +42,7 @@ void UMounteaInteractableComponentPress::InteractionStarted_Implementation(const
 			if (Execute_TriggerCooldown(this)) return;
 		}
 		
-		OnInteractionCompleted.Broadcast(TimeStarted, CausingInteractor);
+		BroadcastEvent(&FMounteaInteractableEventHandlers::InteractionCompleted, OnInteractionCompletedNative, OnInteractionCompleted, TimeStarted, CausingInteractor);
 	}
 }
 
@@ -49,6 +51,7 @@ void UMounteaInteractableComponentPress::SetDefaults_Implementation()
 	Super::SetDefaults_Implementation();
 
 	InteractionPeriod = -1.f;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractableComponentBase, InteractionPeriod, this);
 }
 
 #if WITH_EDITOR
@@ -2,7 +2,10 @@
 
 
 #include "Components/Interactor/MounteaInteractorComponentBase.h"
+#include "Components/Interactable/MounteaInteractableComponentBase.h"
 #include "Components/MeshComponent.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
 
 #if WITH_EDITOR
 
@@ -15,12 +18,17 @@
 #include "Helpers/MounteaInteractionHelpers.h"
 #include "Helpers/MounteaInteractionSystemBFL.h"
 #include "Helpers/MounteaInteractionSystemLog.h"
+#include "Helpers/MounteaInteractionSystemSettings.h"
 
 #include "Interfaces/MounteaInteractableInterface.h"
+#include "Subsystems/MounteaInteractionDependencySubsystem.h"
+#include "Subsystems/MounteaInteractionRegistrySubsystem.h"
+#include "Subsystems/MounteaServerRPCLimiterSubsystem.h"
 
 #include "GameFramework/Actor.h"
 #include "Engine/HitResult.h"
 #include "Engine/World.h"
+#include "TimerManager.h"
 
 #include "Net/UnrealNetwork.h"
 #include "Net/Core/PushModel/PushModel.h"
@@ -50,19 +58,36 @@ UMounteaInteractorComponentBase::UMounteaInteractorComponentBase() :
 #endif
 }
 
+void UMounteaInteractorComponentBase::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// Not copied from Archetype, so each instance points to itself
+	InteractionDependencies.Owner = this;
+}
+
 void UMounteaInteractorComponentBase::BeginPlay()
 {
 	Super::BeginPlay();
+
+	NativeDispatchFunctions = FMounteaInteractorDispatch::GetNativeFunctions(GetClass());
+
+	if (UMounteaInteractionRegistrySubsystem* Registry = UMounteaInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterInteractor(this);
+	}
 	
-	OnInteractableUpdated.			AddUniqueDynamic(this, &UMounteaInteractorComponentBase::InteractableSelected);
-	OnInteractableFound.				AddUniqueDynamic(this, &UMounteaInteractorComponentBase::InteractableFound);
-	OnInteractableLost.					AddUniqueDynamic(this, &UMounteaInteractorComponentBase::InteractableLost);
+	// Interface events are dispatched through Execute_, so Blueprint overrides are still called
+	OnInteractableUpdatedNative.		AddWeakLambda(this, [this](const TScriptInterface<IMounteaInteractableInterface>& Interactable) { Execute_InteractableSelected(this, Interactable); });
+	OnInteractableFoundNative.			AddWeakLambda(this, [this](const TScriptInterface<IMounteaInteractableInterface>& Interactable) { Execute_InteractableFound(this, Interactable); });
+	OnInteractableLostNative.			AddWeakLambda(this, [this](const TScriptInterface<IMounteaInteractableInterface>& Interactable) { Execute_InteractableLost(this, Interactable); });
 	
+	// Key events are raised by callers, so own handlers stay bound to the Dynamic events
 	OnInteractionKeyPressed.		AddUniqueDynamic(this, &UMounteaInteractorComponentBase::OnInteractionKeyPressedEvent);
 	OnInteractionKeyReleased.	AddUniqueDynamic(this, &UMounteaInteractorComponentBase::OnInteractionKeyReleasedEvent);
 	
-	OnStateChanged.					AddUniqueDynamic(this, &UMounteaInteractorComponentBase::OnInteractorStateChanged);
-	OnCollisionChanged.				AddUniqueDynamic(this, &UMounteaInteractorComponentBase::OnInteractorCollisionChanged);
+	OnStateChangedNative.				AddWeakLambda(this, [this](const EInteractorStateV2& NewState) { Execute_OnInteractorStateChanged(this, NewState); });
+	OnCollisionChangedNative.			AddWeakLambda(this, [this](const TEnumAsByte<ECollisionChannel>& NewChannel) { Execute_OnInteractorCollisionChanged(this, NewChannel); });
 	OnComponentActivated.			AddUniqueDynamic(this, &UMounteaInteractorComponentBase::OnInteractorComponentActivated);
 
 	if (GetOwner() &&( bAutoActivate || IsActive()))
@@ -73,6 +98,39 @@ void UMounteaInteractorComponentBase::BeginPlay()
 	}	
 }
 
+void UMounteaInteractorComponentBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UMounteaInteractionRegistrySubsystem* Registry = UMounteaInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterInteractor(this);
+	}
+
+	if (UMounteaInteractionDependencySubsystem* DependencySubsystem = UMounteaInteractionDependencySubsystem::Get(this))
+	{
+		DependencySubsystem->RemoveNode(this);
+	}
+
+	UMounteaInteractionRegistrySubsystem::ReleaseInteractorHandle(this);
+	InteractorHandle.Reset();
+
+	if (GetWorld())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(PendingServerRPCsTimerHandle);
+	}
+	PendingServerRPCs.Empty();
+	
+	Super::EndPlay(EndPlayReason);
+}
+
+FMounteaInteractorHandle UMounteaInteractorComponentBase::GetInteractorHandle() const
+{
+	if (!InteractorHandle.IsValid())
+	{
+		InteractorHandle = UMounteaInteractionRegistrySubsystem::AcquireInteractorHandle(this);
+	}
+	return InteractorHandle;
+}
+
 FString UMounteaInteractorComponentBase::ToString_Implementation() const
 {
 	TScriptInterface<IMounteaInteractableInterface> activeInteractable = Execute_GetActiveInteractable(this);
@@ -141,15 +199,7 @@ bool UMounteaInteractorComponentBase::PerformSafetyTrace_Implementation(const AA
 			traceStartLocation = SafetyTraceSetup.StartLocation;
 			break;
 		case ESafetyTracingMode::ESTM_Socket:
-			{
-				if (const auto ownerMesh =  UMounteaInteractionSystemBFL::FindMeshByName(SafetyTraceSetup.StartSocketName, GetOwner()))
-				{
-					traceStartLocation =
-						ownerMesh->DoesSocketExist(SafetyTraceSetup.StartSocketName) ?
-						ownerMesh->GetSocketLocation(SafetyTraceSetup.StartSocketName) :
-						traceStartLocation;
-				}
-			}
+			GetSafetyTraceSocketLocation(traceStartLocation);
 			break;
 		case ESafetyTracingMode::Default:
 		case ESafetyTracingMode::ESTM_None:
@@ -170,6 +220,103 @@ bool UMounteaInteractorComponentBase::PerformSafetyTrace_Implementation(const AA
 	return bHit && safetyTrace.GetActor() == InteractableActor;
 }
 
+namespace MounteaSafetyTrace
+{
+	const UObject* GetMeshAsset(const UMeshComponent* Mesh)
+	{
+		if (const UStaticMeshComponent* StaticMesh = Cast<UStaticMeshComponent>(Mesh))
+		{
+			return StaticMesh->GetStaticMesh();
+		}
+		if (const USkinnedMeshComponent* SkinnedMesh = Cast<USkinnedMeshComponent>(Mesh))
+		{
+			return SkinnedMesh->GetSkinnedAsset();
+		}
+		return nullptr;
+	}
+}
+
+void UMounteaInteractorComponentBase::ResolveSafetyTraceOrigin()
+{
+	SafetyTraceOrigin = FSafetyTraceOrigin();
+	SafetyTraceOrigin.MeshName = SafetyTraceSetup.ActorMeshName;
+	SafetyTraceOrigin.SocketName = SafetyTraceSetup.StartSocketName;
+	SafetyTraceOrigin.bResolved = true;
+
+	if (!GetOwner()) return;
+	
+	SafetyTraceOrigin.NumOwnerComponents = GetOwner()->GetComponents().Num();
+
+	UMeshComponent* Mesh = nullptr;
+	if (!SafetyTraceSetup.ActorMeshName.IsNone())
+	{
+		Mesh = UMounteaInteractionSystemBFL::FindMeshByName(SafetyTraceSetup.ActorMeshName, GetOwner());
+	}
+	else
+	{
+		// Without Mesh Name the first Owner Mesh with the Socket is used
+		TArray<UMeshComponent*> OwnerMeshes;
+		GetOwner()->GetComponents(OwnerMeshes);
+
+		UMeshComponent* const* FoundMesh = OwnerMeshes.FindByPredicate([this](const UMeshComponent* Itr) { return Itr && Itr->DoesSocketExist(SafetyTraceSetup.StartSocketName); });
+		Mesh = FoundMesh ? *FoundMesh : nullptr;
+	}
+	
+	if (!Mesh || !Mesh->DoesSocketExist(SafetyTraceSetup.StartSocketName))
+	{
+		LOG_WARNING(TEXT("[PerformSafetyTrace] Socket '%s' of Mesh '%s' not found, Owner Location is used instead!"), *SafetyTraceSetup.StartSocketName.ToString(), *SafetyTraceSetup.ActorMeshName.ToString())
+		return;
+	}
+
+	SafetyTraceOrigin.Mesh = Mesh;
+	SafetyTraceOrigin.MeshAsset = MounteaSafetyTrace::GetMeshAsset(Mesh);
+
+	// Skeletal Sockets follow their Bones, so only Bone and offset from it are kept
+	FTransform SocketTransform = FTransform::Identity;
+	if (const USkinnedMeshComponent* SkinnedMesh = Cast<USkinnedMeshComponent>(Mesh))
+	{
+		SkinnedMesh->GetSocketInfoByName(SafetyTraceSetup.StartSocketName, SocketTransform, SafetyTraceOrigin.BoneIndex);
+	}
+
+	if (SafetyTraceOrigin.BoneIndex == INDEX_NONE)
+	{
+		SocketTransform = Mesh->GetSocketTransform(SafetyTraceSetup.StartSocketName, RTS_Component);
+	}
+	
+	SafetyTraceOrigin.SocketLocation = SocketTransform.GetLocation();
+}
+
+bool UMounteaInteractorComponentBase::GetSafetyTraceSocketLocation(FVector& OutLocation)
+{
+	const bool bSetupChanged = !SafetyTraceOrigin.bResolved
+		|| SafetyTraceOrigin.MeshName != SafetyTraceSetup.ActorMeshName
+		|| SafetyTraceOrigin.SocketName != SafetyTraceSetup.StartSocketName;
+
+	const UMeshComponent* Mesh = SafetyTraceOrigin.Mesh.Get();
+	const bool bMeshChanged = Mesh
+		? SafetyTraceOrigin.MeshAsset.Get() != MounteaSafetyTrace::GetMeshAsset(Mesh)
+		: GetOwner() && GetOwner()->GetComponents().Num() != SafetyTraceOrigin.NumOwnerComponents;
+	
+	if (bSetupChanged || bMeshChanged)
+	{
+		ResolveSafetyTraceOrigin();
+		Mesh = SafetyTraceOrigin.Mesh.Get();
+	}
+
+	if (!Mesh) return false;
+
+	if (SafetyTraceOrigin.BoneIndex != INDEX_NONE)
+	{
+		OutLocation = static_cast<const USkinnedMeshComponent*>(Mesh)->GetBoneTransform(SafetyTraceOrigin.BoneIndex).TransformPosition(SafetyTraceOrigin.SocketLocation);
+	}
+	else
+	{
+		OutLocation = Mesh->GetComponentTransform().TransformPosition(SafetyTraceOrigin.SocketLocation);
+	}
+	
+	return true;
+}
+
 void UMounteaInteractorComponentBase::SetDefaults_Implementation()
 {
 	const auto defaultValues = UMounteaInteractionFunctionLibrary::GetDefaultInteractorSettings();
@@ -178,18 +325,20 @@ void UMounteaInteractorComponentBase::SetDefaults_Implementation()
 		InteractorTag				= defaultValues.InteractorTag;
 		DefaultInteractorState = defaultValues.DefaultInteractorState;
 	}
+
+	bFilterKeyDirty = true;
 }
 
 void UMounteaInteractorComponentBase::ConsumeInput_Implementation(UInputAction* ConsumedInput)
 {
-	OnInputActionConsumed.Broadcast(ConsumedInput);
+	MounteaInteractionEvents::Broadcast(OnInputActionConsumedNative, OnInputActionConsumed, ConsumedInput);
 }
 
 void UMounteaInteractorComponentBase::InteractableSelected_Implementation(const TScriptInterface<IMounteaInteractableInterface>& SelectedInteractable)
 {
 	if (SelectedInteractable.GetObject())
 	{
-		SelectedInteractable->GetOnInteractableSelectedHandle().Broadcast(SelectedInteractable);
+		SelectedInteractable->BroadcastInteractableSelected(SelectedInteractable);
 	}
 	
 	Execute_OnInteractableSelectedEvent(this, SelectedInteractable);
@@ -197,11 +346,13 @@ void UMounteaInteractorComponentBase::InteractableSelected_Implementation(const
 
 void UMounteaInteractorComponentBase::InteractableFound_Implementation(const TScriptInterface<IMounteaInteractableInterface>& FoundInteractable)
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("InteractableFound"));
+
 	if (FoundInteractable.GetInterface() == nullptr) return;
 
 	if (FoundInteractable != ActiveInteractable)
 	{
-		for (const auto& Itr : InteractionDependencies)
+		for (const auto& Itr : InteractionDependencies.GetDependencies())
 		{
 			if (Itr.GetInterface())
 			{
@@ -217,6 +368,8 @@ void UMounteaInteractorComponentBase::InteractableFound_Implementation(const TSc
 
 void UMounteaInteractorComponentBase::InteractableLost_Implementation(const TScriptInterface<IMounteaInteractableInterface>& LostInteractable)
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("InteractableLost"));
+
 	if (LostInteractable.GetInterface() == nullptr)
 		return;
 
@@ -225,7 +378,7 @@ void UMounteaInteractorComponentBase::InteractableLost_Implementation(const TScr
 	
 	if (LostInteractable == ActiveInteractable)
 	{
-		ActiveInteractable->GetOnInteractorLostHandle().Broadcast(this);
+		ActiveInteractable->BroadcastInteractorLost(this);
 		
 		Execute_SetState(this, EInteractorStateV2::EIS_Awake);
 		
@@ -257,14 +410,14 @@ void UMounteaInteractorComponentBase::EvaluateInteractable_Implementation(const
 	
 	if (FoundInteractable.GetInterface() == nullptr)
 	{
-		OnInteractableLost.Broadcast(ActiveInteractable);
+		MounteaInteractionEvents::Broadcast(OnInteractableLostNative, OnInteractableLost, ActiveInteractable);
 		return;
 	}
 	
 	if (ActiveInteractable.GetInterface() == nullptr)
 	{
 		Execute_SetActiveInteractable(this, FoundInteractable);
-		OnInteractableUpdated.Broadcast(FoundInteractable);
+		MounteaInteractionEvents::Broadcast(OnInteractableUpdatedNative, OnInteractableUpdated, FoundInteractable);
 
 		return;
 	}
@@ -279,32 +432,34 @@ void UMounteaInteractorComponentBase::EvaluateInteractable_Implementation(const
 		{
 			if (ActiveInteractable.GetInterface() != nullptr)
 			{
-				OnInteractableLost.Broadcast(ActiveInteractable);
+				MounteaInteractionEvents::Broadcast(OnInteractableLostNative, OnInteractableLost, ActiveInteractable);
 			}
 			
 			
 			Execute_SetActiveInteractable(this, FoundInteractable);
-			OnInteractableUpdated.Broadcast(FoundInteractable);
+			MounteaInteractionEvents::Broadcast(OnInteractableUpdatedNative, OnInteractableUpdated, FoundInteractable);
 		}
 		else
 		{
 			if (FoundInteractable.GetInterface() != nullptr)
 			{
-				OnInteractableLost.Broadcast(FoundInteractable);
+				MounteaInteractionEvents::Broadcast(OnInteractableLostNative, OnInteractableLost, FoundInteractable);
 			}
 
-			OnInteractableUpdated.Broadcast(ActiveInteractable);
+			MounteaInteractionEvents::Broadcast(OnInteractableUpdatedNative, OnInteractableUpdated, ActiveInteractable);
 		}
 	}
 	else
 	{
 		Execute_SetActiveInteractable(this, FoundInteractable);
-		OnInteractableUpdated.Broadcast(FoundInteractable);
+		MounteaInteractionEvents::Broadcast(OnInteractableUpdatedNative, OnInteractableUpdated, FoundInteractable);
 	}
 }
 
 void UMounteaInteractorComponentBase::StartInteraction_Implementation(const float StartTime)
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("StartInteraction"));
+
 	if (!GetOwner())
 	{
 		LOG_ERROR(TEXT("[StartInteraction] No Owner!"))
@@ -316,7 +471,7 @@ void UMounteaInteractorComponentBase::StartInteraction_Implementation(const floa
 		if (Execute_CanInteract(this) && ActiveInteractable.GetInterface())
 		{
 			Execute_SetState(this,EInteractorStateV2::EIS_Active);
-			ActiveInteractable->GetOnInteractionStartedHandle().Broadcast(StartTime, this);
+			ActiveInteractable->BroadcastInteractionStarted(StartTime, this);
 		}
 	}
 	else
@@ -327,6 +482,8 @@ void UMounteaInteractorComponentBase::StartInteraction_Implementation(const floa
 
 void UMounteaInteractorComponentBase::StopInteraction_Implementation(const float StopTime)
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("StopInteraction"));
+
 	if (!GetOwner())
 	{
 		LOG_ERROR(TEXT("[StopInteraction] No Owner!"))
@@ -338,7 +495,7 @@ void UMounteaInteractorComponentBase::StopInteraction_Implementation(const float
 		if (Execute_CanInteract(this) && ActiveInteractable.GetInterface())
 		{
 			Execute_SetState(this,DefaultInteractorState);
-			ActiveInteractable->GetOnInteractionStoppedHandle().Broadcast(StopTime, this);
+			ActiveInteractable->BroadcastInteractionStopped(StopTime, this);
 		}
 	}
 	else
@@ -349,6 +506,8 @@ void UMounteaInteractorComponentBase::StopInteraction_Implementation(const float
 
 bool UMounteaInteractorComponentBase::ActivateInteractor_Implementation(FString& ErrorMessage)
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("ActivateInteractor"));
+
 	const EInteractorStateV2 CachedState = InteractorState;
 	
 	Execute_SetState(this, EInteractorStateV2::EIS_Active);
@@ -377,6 +536,8 @@ bool UMounteaInteractorComponentBase::ActivateInteractor_Implementation(FString&
 
 bool UMounteaInteractorComponentBase::EnableInteractor_Implementation(FString& ErrorMessage)
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("EnableInteractor"));
+
 	const EInteractorStateV2 CachedState = InteractorState;
 	
 	Execute_SetState(this, EInteractorStateV2::EIS_Awake);
@@ -403,6 +564,8 @@ bool UMounteaInteractorComponentBase::EnableInteractor_Implementation(FString& E
 
 bool UMounteaInteractorComponentBase::SuppressInteractor_Implementation(FString& ErrorMessage)
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("SuppressInteractor"));
+
 	const EInteractorStateV2 CachedState = InteractorState;
 	
 	Execute_SetState(this, EInteractorStateV2::EIS_Suppressed);
@@ -432,7 +595,11 @@ bool UMounteaInteractorComponentBase::SuppressInteractor_Implementation(FString&
 }
 
 void UMounteaInteractorComponentBase::DeactivateInteractor_Implementation()
-{	Execute_SetState(this, EInteractorStateV2::EIS_Disabled); }
+{
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("DeactivateInteractor"));
+
+	Execute_SetState(this, EInteractorStateV2::EIS_Disabled);
+}
 
 void UMounteaInteractorComponentBase::AddIgnoredActor_Implementation(AActor* IgnoredActor)
 {
@@ -449,7 +616,7 @@ void UMounteaInteractorComponentBase::AddIgnoredActor_Implementation(AActor* Ign
 
 		ListOfIgnoredActors.Add(IgnoredActor);
 
-		OnIgnoredActorAdded.Broadcast(IgnoredActor);
+		MounteaInteractionEvents::Broadcast(OnIgnoredActorAddedNative, OnIgnoredActorAdded, IgnoredActor);
 
 		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractorComponentBase, ListOfIgnoredActors, this);
 	}
@@ -476,7 +643,7 @@ void UMounteaInteractorComponentBase::AddIgnoredActors_Implementation(const TArr
 			if (ListOfIgnoredActors.Contains(Itr)) continue;	
 
 			ListOfIgnoredActors.Add(Itr);
-			OnIgnoredActorAdded.Broadcast(Itr);
+			MounteaInteractionEvents::Broadcast(OnIgnoredActorAddedNative, OnIgnoredActorAdded, Itr);
 			bListModified = true;
 		}
 
@@ -505,7 +672,7 @@ void UMounteaInteractorComponentBase::RemoveIgnoredActor_Implementation(AActor*
 		if (ListOfIgnoredActors.Contains(UnignoredActor))
 		{
 			ListOfIgnoredActors.Remove(UnignoredActor);
-			OnIgnoredActorRemoved.Broadcast(UnignoredActor);
+			MounteaInteractionEvents::Broadcast(OnIgnoredActorRemovedNative, OnIgnoredActorRemoved, UnignoredActor);
 
 			MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractorComponentBase, ListOfIgnoredActors, this);
 		}
@@ -533,7 +700,7 @@ void UMounteaInteractorComponentBase::RemoveIgnoredActors_Implementation(const T
 			if (ListOfIgnoredActors.Contains(Itr))
 			{
 				ListOfIgnoredActors.Remove(Itr);
-				OnIgnoredActorRemoved.Broadcast(Itr);
+				MounteaInteractionEvents::Broadcast(OnIgnoredActorRemovedNative, OnIgnoredActorRemoved, Itr);
 				bListModified = true;
 			}
 		}
@@ -568,10 +735,17 @@ void UMounteaInteractorComponentBase::AddInteractionDependency_Implementation(co
 			return;
 		}
 
-		InteractionDependencies.Add(InteractionDependency);
-		Execute_ProcessDependencies(this);
+		UMounteaInteractionDependencySubsystem* DependencySubsystem = UMounteaInteractionDependencySubsystem::Get(this);
+		if (DependencySubsystem && !DependencySubsystem->AddDependency(this, InteractionDependency.GetObject()))
+		{
+			LOG_ERROR(TEXT("[AddInteractionDependency] Dependency would create a cycle!"));
+			return;
+		}
 
-		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractorComponentBase, InteractionDependencies, this);
+		InteractionDependencies.Add(InteractionDependency);
+		ProcessDependencyAdded(InteractionDependency);
+		
+		RequestDependencyProcessing();
 	}
 	else
 	{
@@ -581,6 +755,8 @@ void UMounteaInteractorComponentBase::AddInteractionDependency_Implementation(co
 
 void UMounteaInteractorComponentBase::RemoveInteractionDependency_Implementation(const TScriptInterface<IMounteaInteractorInterface>& InteractionDependency)
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("RemoveInteractionDependency"));
+
 	if (!GetOwner())
 	{
 		LOG_ERROR(TEXT("[RemoveInteractionDependency] No owner!"));
@@ -594,8 +770,12 @@ void UMounteaInteractorComponentBase::RemoveInteractionDependency_Implementation
 		{
 			InteractionDependency->Execute_SetState(this, InteractionDependency->Execute_GetDefaultState(this));
 			InteractionDependencies.Remove(InteractionDependency);
+			ProcessDependencyRemoved(InteractionDependency);
 
-			MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractorComponentBase, InteractionDependencies, this);
+			if (UMounteaInteractionDependencySubsystem* DependencySubsystem = UMounteaInteractionDependencySubsystem::Get(this))
+			{
+				DependencySubsystem->RemoveDependency(this, InteractionDependency.GetObject());
+			}
 		}
 	}
 	else
@@ -605,10 +785,12 @@ void UMounteaInteractorComponentBase::RemoveInteractionDependency_Implementation
 }
 
 TArray<TScriptInterface<IMounteaInteractorInterface>> UMounteaInteractorComponentBase::GetInteractionDependencies_Implementation() const
-{	return InteractionDependencies;}
+{	return InteractionDependencies.GetDependencies();}
 
 void UMounteaInteractorComponentBase::ProcessDependencies_Implementation()
 {
+	const MounteaInteractionStateMachine::FScopedTransitionCause TransitionCause(TEXT("ProcessDependencies"));
+
 	if (!GetOwner())
 	{
 		LOG_ERROR(TEXT("[ProcessDependencies] No owner!"));
@@ -618,8 +800,9 @@ void UMounteaInteractorComponentBase::ProcessDependencies_Implementation()
 	if (GetOwner()->HasAuthority())
 	{
 		if (InteractionDependencies.Num() == 0) return;
-	
-		for (const auto& Itr : InteractionDependencies)
+
+		// Copy, as Disabled state removes Dependencies while iterating
+		for (const auto& Itr : InteractionDependencies.GetDependencies())
 		{
 			switch (InteractorState)
 			{
@@ -647,6 +830,110 @@ void UMounteaInteractorComponentBase::ProcessDependencies_Implementation()
 	}
 }
 
+bool UMounteaInteractorComponentBase::ConsumeServerRPCToken(const EMounteaServerRPCType RPCType, const float MinTokensPerSecond) const
+{
+	if (!GetOwner()) return false;
+	
+	const UMounteaInteractionSystemSettings* Settings = GetDefault<UMounteaInteractionSystemSettings>();
+	if (!Settings->IsServerRPCRateLimitingEnabled()) return true;
+
+	// Local Player on Listen Server has no Connection and is never limited
+	const UNetConnection* Connection = GetOwner()->GetNetConnection();
+	if (!Connection) return true;
+
+	UMounteaServerRPCLimiterSubsystem* Limiter = UMounteaServerRPCLimiterSubsystem::Get(this);
+	return Limiter ? Limiter->ConsumeToken(Connection, RPCType, MinTokensPerSecond) : true;
+}
+
+namespace MounteaServerRPC
+{
+	/** How many distinct Requests may wait for budget, newer ones are dropped. */
+	constexpr int32 MaxPendingRequests = 64;
+}
+
+void UMounteaInteractorComponentBase::CoalesceServerRPC(const EMounteaServerRPCType RPCType, const FName& RequestKey, TFunction<void()>&& Request)
+{
+	// Newer Request supersedes pending one, so stale value is never applied after it
+	PendingServerRPCs.Remove(RequestKey);
+
+	if (ConsumeServerRPCToken(RPCType))
+	{
+		Request();
+		return;
+	}
+
+	if (PendingServerRPCs.Num() >= MounteaServerRPC::MaxPendingRequests)
+	{
+		LOG_WARNING(TEXT("[CoalesceServerRPC] Too many pending Server RPCs, %s is dropped!"), *RequestKey.ToString())
+		return;
+	}
+
+	PendingServerRPCs.Add(RequestKey, { RPCType, MoveTemp(Request) });
+	SchedulePendingServerRPCs();
+}
+
+void UMounteaInteractorComponentBase::CancelPendingServerRPC(const FName& RequestKey)
+{
+	PendingServerRPCs.Remove(RequestKey);
+}
+
+void UMounteaInteractorComponentBase::FlushPendingServerRPCs()
+{
+	// Ready Requests are collected first, as applying one might queue another
+	TArray<TFunction<void()>> ReadyRequests;
+	for (auto Itr = PendingServerRPCs.CreateIterator(); Itr; ++Itr)
+	{
+		if (!ConsumeServerRPCToken(Itr.Value().RPCType)) continue;
+
+		ReadyRequests.Add(MoveTemp(Itr.Value().Request));
+		Itr.RemoveCurrent();
+	}
+
+	for (const TFunction<void()>& Itr : ReadyRequests)
+	{
+		Itr();
+	}
+
+	SchedulePendingServerRPCs();
+}
+
+void UMounteaInteractorComponentBase::SchedulePendingServerRPCs()
+{
+	UWorld* World = GetWorld();
+	if (!World || PendingServerRPCs.Num() == 0 || World->GetTimerManager().IsTimerActive(PendingServerRPCsTimerHandle)) return;
+
+	const UMounteaServerRPCLimiterSubsystem* Limiter = UMounteaServerRPCLimiterSubsystem::Get(this);
+	if (!Limiter) return;
+
+	// Retried once the fastest pending type refills a token
+	float Interval = TNumericLimits<float>::Max();
+	for (const auto& Itr : PendingServerRPCs)
+	{
+		Interval = FMath::Min(Interval, Limiter->GetTokenInterval(Itr.Value.RPCType));
+	}
+
+	World->GetTimerManager().SetTimer(PendingServerRPCsTimerHandle, this, &UMounteaInteractorComponentBase::FlushPendingServerRPCs, FMath::Max(0.01f, Interval), false);
+}
+
+void UMounteaInteractorComponentBase::ProcessDependencyAdded(const TScriptInterface<IMounteaInteractorInterface>& AddedDependency)
+{
+	MounteaInteractionEvents::Broadcast(OnInteractionDependencyAddedNative, OnInteractionDependencyAdded, AddedDependency);
+}
+
+void UMounteaInteractorComponentBase::ProcessDependencyRemoved(const TScriptInterface<IMounteaInteractorInterface>& RemovedDependency)
+{
+	MounteaInteractionEvents::Broadcast(OnInteractionDependencyRemovedNative, OnInteractionDependencyRemoved, RemovedDependency);
+}
+
+void UMounteaInteractorComponentBase::RequestDependencyProcessing()
+{
+	UMounteaInteractionDependencySubsystem* DependencySubsystem = UMounteaInteractionDependencySubsystem::Get(this);
+	if (!DependencySubsystem || !DependencySubsystem->MarkDirty(this))
+	{
+		Execute_ProcessDependencies(this);
+	}
+}
+
 bool UMounteaInteractorComponentBase::CanInteract_Implementation() const
 {
 	switch (InteractorState)
@@ -677,8 +964,9 @@ void UMounteaInteractorComponentBase::SetResponseChannel_Implementation(const EC
 	if (GetOwner()->HasAuthority())
 	{
 		CollisionChannel = NewResponseChannel;
+		bFilterKeyDirty = true;
 
-		OnCollisionChanged.Broadcast(NewResponseChannel);
+		MounteaInteractionEvents::Broadcast(OnCollisionChangedNative, OnCollisionChanged, NewResponseChannel);
 	}
 	else
 	{
@@ -699,88 +987,17 @@ void UMounteaInteractorComponentBase::SetState_Implementation(const EInteractorS
 
 	if (GetOwner()->HasAuthority())
 	{
-		switch (NewState)
+		const EInteractorStateV2 PreviousState = InteractorState;
+		const EMounteaInteractorTransitionActions Actions = MounteaInteractionStateMachine::InteractorTransitions.Get(PreviousState, NewState);
+
+		if (MounteaInteractionStateMachine::OnInteractorTransition().IsBound())
 		{
-			case EInteractorStateV2::EIS_Awake:
-				switch (InteractorState)
-				{
-					case EInteractorStateV2::EIS_Asleep:
-					case EInteractorStateV2::EIS_Disabled:
-					case EInteractorStateV2::EIS_Suppressed:
-					case EInteractorStateV2::EIS_Active:
-						InteractorState = NewState;
-						ProcessStateChanged();
-						break;
-					case EInteractorStateV2::EIS_Awake:
-					case EInteractorStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractorStateV2::EIS_Asleep:
-				switch (InteractorState)
-				{
-					case EInteractorStateV2::EIS_Awake:
-					case EInteractorStateV2::EIS_Suppressed:
-					case EInteractorStateV2::EIS_Active:
-					case EInteractorStateV2::EIS_Disabled:
-						InteractorState = NewState;
-						ProcessStateChanged();
-						break;
-					case EInteractorStateV2::EIS_Asleep:
-					case EInteractorStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractorStateV2::EIS_Suppressed:
-				switch (InteractorState)
-				{
-					case EInteractorStateV2::EIS_Awake:
-					case EInteractorStateV2::EIS_Asleep:
-					case EInteractorStateV2::EIS_Active:
-						InteractorState = NewState;
-						ProcessStateChanged();
-						break;
-					case EInteractorStateV2::EIS_Suppressed:
-					case EInteractorStateV2::EIS_Disabled:
-					case EInteractorStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractorStateV2::EIS_Active:
-				switch (InteractorState)
-				{
-					case EInteractorStateV2::EIS_Awake:
-						InteractorState = NewState;
-						ProcessStateChanged();
-						break;
-					case EInteractorStateV2::EIS_Asleep:
-					case EInteractorStateV2::EIS_Active:
-					case EInteractorStateV2::EIS_Suppressed:
-					case EInteractorStateV2::EIS_Disabled:
-					case EInteractorStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractorStateV2::EIS_Disabled:
-				switch (InteractorState)
-				{
-					case EInteractorStateV2::EIS_Asleep:
-					case EInteractorStateV2::EIS_Awake:
-					case EInteractorStateV2::EIS_Suppressed:
-					case EInteractorStateV2::EIS_Active:
-						InteractorState = NewState;
-						ProcessStateChanged();
-						break;
-					case EInteractorStateV2::EIS_Disabled:
-					case EInteractorStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractorStateV2::Default:
-			default: break;
+			MounteaInteractionStateMachine::OnInteractorTransition().Broadcast(this, PreviousState, NewState, Actions, MounteaInteractionStateMachine::GetTransitionCause());
 		}
 
-		Execute_ProcessDependencies(this);
+		ProcessStateTransition(NewState, Actions);
+
+		RequestDependencyProcessing();
 	}
 	else
 	{
@@ -846,14 +1063,16 @@ void UMounteaInteractorComponentBase::SetActiveInteractable_Implementation(const
 		{
 			ActiveInteractable = NewInteractable;
 
-			OnInteractableUpdated.Broadcast(ActiveInteractable);
+			MounteaInteractionEvents::Broadcast(OnInteractableUpdatedNative, OnInteractableUpdated, ActiveInteractable);
 		}
 
-		SetActiveInteractable_Client(ActiveInteractable);
+		ActiveInteractableHandle = FMounteaInteractableHandle::Get(ActiveInteractable);
+
+		SetActiveInteractable_Client(ActiveInteractableHandle);
 	}
 	else
 	{
-		SetActiveInteractable_Server(NewInteractable);
+		SetActiveInteractable_Server(FMounteaInteractableHandle::Get(NewInteractable));
 	}
 }
 
@@ -888,8 +1107,9 @@ void UMounteaInteractorComponentBase::SetInteractorTag_Implementation(const FGam
 		if (InteractorTag != NewInteractorTag)
 		{
 			InteractorTag = NewInteractorTag;
+			bFilterKeyDirty = true;
 
-			OnInteractorTagChanged.Broadcast(NewInteractorTag);
+			MounteaInteractionEvents::Broadcast(OnInteractorTagChangedNative, OnInteractorTagChanged, NewInteractorTag);
 		}
 	}
 	else
@@ -907,72 +1127,138 @@ void UMounteaInteractorComponentBase::OnInteractorComponentActivated_Implementat
 
 void UMounteaInteractorComponentBase::AddIgnoredActors_Server_Implementation(const TArray<AActor*>& IgnoredActors)
 {
-	Execute_AddIgnoredActors(this, IgnoredActors);
+	// Each Actor keeps only its latest Ignored request
+	for (AActor* Itr : IgnoredActors)
+	{
+		AddIgnoredActor_Server_Implementation(Itr);
+	}
 }
 
 void UMounteaInteractorComponentBase::AddIgnoredActor_Server_Implementation(AActor* IgnoredActor)
 {
-	Execute_AddIgnoredActor(this, IgnoredActor);
+	if (!IgnoredActor) return;
+
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_Config, FName(TEXT("IgnoredActor"), IgnoredActor->GetUniqueID()), [this, WeakActor = TWeakObjectPtr<AActor>(IgnoredActor)]()
+	{
+		if (AActor* Actor = WeakActor.Get())
+		{
+			Execute_AddIgnoredActor(this, Actor);
+		}
+	});
 }
 
 void UMounteaInteractorComponentBase::AddInteractionDependency_Server_Implementation(const TScriptInterface<IMounteaInteractorInterface>& InteractionDependency)
 {
-	Execute_AddInteractionDependency(this, InteractionDependency);
+	if (!InteractionDependency.GetObject()) return;
+
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_Config, FName(TEXT("InteractionDependency"), InteractionDependency.GetObject()->GetUniqueID()), [this, WeakDependency = TWeakObjectPtr<UObject>(InteractionDependency.GetObject())]()
+	{
+		if (UObject* Dependency = WeakDependency.Get())
+		{
+			Execute_AddInteractionDependency(this, TScriptInterface<IMounteaInteractorInterface>(Dependency));
+		}
+	});
 }
 
 void UMounteaInteractorComponentBase::RemoveInteractionDependency_Server_Implementation(const TScriptInterface<IMounteaInteractorInterface>& InteractionDependency)
 {
-	Execute_RemoveInteractionDependency(this, InteractionDependency);
+	if (!InteractionDependency.GetObject()) return;
+
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_Config, FName(TEXT("InteractionDependency"), InteractionDependency.GetObject()->GetUniqueID()), [this, WeakDependency = TWeakObjectPtr<UObject>(InteractionDependency.GetObject())]()
+	{
+		if (UObject* Dependency = WeakDependency.Get())
+		{
+			Execute_RemoveInteractionDependency(this, TScriptInterface<IMounteaInteractorInterface>(Dependency));
+		}
+	});
 }
 
 void UMounteaInteractorComponentBase::RemoveIgnoredActor_Server_Implementation(AActor* IgnoredActor)
 {
-	Execute_RemoveIgnoredActor(this, IgnoredActor);
+	if (!IgnoredActor) return;
+
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_Config, FName(TEXT("IgnoredActor"), IgnoredActor->GetUniqueID()), [this, WeakActor = TWeakObjectPtr<AActor>(IgnoredActor)]()
+	{
+		if (AActor* Actor = WeakActor.Get())
+		{
+			Execute_RemoveIgnoredActor(this, Actor);
+		}
+	});
 }
 
 void UMounteaInteractorComponentBase::RemoveIgnoredActors_Server_Implementation(const TArray<AActor*>& IgnoredActors)
 {
-	Execute_RemoveIgnoredActors(this, IgnoredActors);
+	for (AActor* Itr : IgnoredActors)
+	{
+		RemoveIgnoredActor_Server_Implementation(Itr);
+	}
 }
 
 void UMounteaInteractorComponentBase::ProcessDependencies_Server_Implementation()
 {
-	Execute_ProcessDependencies(this);
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_State, TEXT("ProcessDependencies"), [this]()
+	{
+		Execute_ProcessDependencies(this);
+	});
 }
 
 void UMounteaInteractorComponentBase::SetResponseChannel_Server_Implementation(const ECollisionChannel NewResponseCollision)
 {
-	Execute_SetResponseChannel(this, NewResponseCollision);
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_Config, TEXT("ResponseChannel"), [this, NewResponseCollision]()
+	{
+		Execute_SetResponseChannel(this, NewResponseCollision);
+	});
 }
 
 void UMounteaInteractorComponentBase::SetDefaultState_Server_Implementation(const EInteractorStateV2 NewState)
 {
-	Execute_SetDefaultState(this, NewState);
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_Config, TEXT("DefaultState"), [this, NewState]()
+	{
+		Execute_SetDefaultState(this, NewState);
+	});
 }
 
-void UMounteaInteractorComponentBase::SetActiveInteractable_Server_Implementation(const TScriptInterface<IMounteaInteractableInterface>& NewInteractable)
+void UMounteaInteractorComponentBase::SetActiveInteractable_Server_Implementation(const FMounteaInteractableHandle& NewInteractable)
 {
-	Execute_SetActiveInteractable(this, NewInteractable);
+	// Clearing Active Interactable is never dropped
+	if (NewInteractable.GetObject() && !ConsumeServerRPCToken(EMounteaServerRPCType::ESRT_Interaction)) return;
+
+	Execute_SetActiveInteractable(this, NewInteractable.GetInterface());
 }
 
 void UMounteaInteractorComponentBase::SetInteractorTag_Server_Implementation(const FGameplayTag& NewInteractorTag)
 {
-	Execute_SetInteractorTag(this, NewInteractorTag);
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_Config, TEXT("InteractorTag"), [this, NewInteractorTag]()
+	{
+		Execute_SetInteractorTag(this, NewInteractorTag);
+	});
 }
 
-void UMounteaInteractorComponentBase::SetActiveInteractable_Client_Implementation(const TScriptInterface<IMounteaInteractableInterface>& NewInteractable)
+void UMounteaInteractorComponentBase::ReleaseInteractableCosmetics_Client_Implementation(const FMounteaInteractableHandle& Interactable)
 {
-	if (NewInteractable.GetObject() != nullptr)
+	if (UMounteaInteractableComponentBase* InteractableComponent = Cast<UMounteaInteractableComponentBase>(Interactable.GetObject()))
 	{
-		OnInteractableUpdated.Broadcast(NewInteractable);
+		InteractableComponent->ReleaseCosmeticState();
+	}
+}
+
+void UMounteaInteractorComponentBase::SetActiveInteractable_Client_Implementation(const FMounteaInteractableHandle& NewInteractable)
+{
+	const TScriptInterface<IMounteaInteractableInterface> Interactable = NewInteractable.GetInterface();
+	if (Interactable.GetObject() != nullptr)
+	{
+		MounteaInteractionEvents::Broadcast(OnInteractableUpdatedNative, OnInteractableUpdated, Interactable);
 	}
 	else
-		OnInteractableLost.Broadcast(NewInteractable);
+		MounteaInteractionEvents::Broadcast(OnInteractableLostNative, OnInteractableLost, Interactable);
 }
 
 void UMounteaInteractorComponentBase::SetSafetyTracingSetup_Server_Implementation(const FSafetyTracingSetup& NewSafetyTracingSetup)
 {
-	Execute_SetSafetyTracingSetup(this, NewSafetyTracingSetup);
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_Config, TEXT("SafetyTracingSetup"), [this, NewSafetyTracingSetup]()
+	{
+		Execute_SetSafetyTracingSetup(this, NewSafetyTracingSetup);
+	});
 }
 
 void UMounteaInteractorComponentBase::OnRep_InteractorState()
@@ -984,30 +1270,57 @@ void UMounteaInteractorComponentBase::ProcessInteractableChanged()
 {
 	if (ActiveInteractable.GetObject() != nullptr)
 	{
-		OnInteractableUpdated.Broadcast(ActiveInteractable);
+		MounteaInteractionEvents::Broadcast(OnInteractableUpdatedNative, OnInteractableUpdated, ActiveInteractable);
 	}
 	else
-		OnInteractableLost.Broadcast(ActiveInteractable);
+		MounteaInteractionEvents::Broadcast(OnInteractableLostNative, OnInteractableLost, ActiveInteractable);
 }
 
 void UMounteaInteractorComponentBase::OnRep_ActiveInteractable()
 {
-	// ...
+	ActiveInteractableHandle = FMounteaInteractableHandle::Get(ActiveInteractable);
+}
+
+void UMounteaInteractorComponentBase::OnRep_FilterKeySource()
+{
+	bFilterKeyDirty = true;
+}
+
+const FMounteaInteractionFilterKey& UMounteaInteractorComponentBase::GetFilterKey() const
+{
+	if (bFilterKeyDirty)
+	{
+		FilterKey = FMounteaInteractionFilterKey::MakeInteractor(CollisionChannel, InteractorTag);
+		bFilterKeyDirty = false;
+	}
+	return FilterKey;
 }
 
 void UMounteaInteractorComponentBase::ProcessStateChanged()
 {
 	// Client side call
-	OnStateChanged.Broadcast(InteractorState);
+	MounteaInteractionEvents::Broadcast(OnStateChangedNative, OnStateChanged, InteractorState);
 }
 
 void UMounteaInteractorComponentBase::ProcessStateChanged_Client()
 {
-	OnStateChanged_Client.Broadcast(InteractorState);
+	MounteaInteractionEvents::Broadcast(OnStateChanged_ClientNative, OnStateChanged_Client, InteractorState);
 	
 	ProcessStateChanged();
 }
 
+void UMounteaInteractorComponentBase::ProcessStateTransition(const EInteractorStateV2 NewState, const EMounteaInteractorTransitionActions Actions)
+{
+	if (EnumHasAnyFlags(Actions, EMounteaInteractorTransitionActions::ChangeState))
+	{
+		InteractorState = NewState;
+	}
+	if (EnumHasAnyFlags(Actions, EMounteaInteractorTransitionActions::ProcessStateChanged))
+	{
+		ProcessStateChanged();
+	}
+}
+
 void UMounteaInteractorComponentBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -1030,17 +1343,35 @@ bool UMounteaInteractorComponentBase::HasInteractable_Implementation() const
 
 void UMounteaInteractorComponentBase::StopInteraction_Server_Implementation(const float StopTime)
 {
-	Execute_StopInteraction(this, StopTime);
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_State, TEXT("StopInteraction"), [this, StopTime]()
+	{
+		Execute_StopInteraction(this, StopTime);
+	});
 }
 
 void UMounteaInteractorComponentBase::StartInteraction_Server_Implementation(const float StartTime)
 {
+	if (!ConsumeServerRPCToken(EMounteaServerRPCType::ESRT_Interaction)) return;
+
+	// Stop requested before this Start must not cancel it later
+	CancelPendingServerRPC(TEXT("StopInteraction"));
+	
 	Execute_StartInteraction(this, StartTime);
 }
 
 void UMounteaInteractorComponentBase::SetState_Server_Implementation(const EInteractorStateV2 NewState)
 {
-	Execute_SetState(this, NewState);
+	// Request for current State does no work and supersedes any pending one
+	if (NewState == InteractorState)
+	{
+		CancelPendingServerRPC(TEXT("State"));
+		return;
+	}
+
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_State, TEXT("State"), [this, NewState]()
+	{
+		Execute_SetState(this, NewState);
+	});
 }
 
 #if WITH_EDITOR
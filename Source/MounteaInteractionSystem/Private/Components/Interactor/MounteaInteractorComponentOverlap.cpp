@@ -51,21 +51,18 @@ void UMounteaInteractorComponentOverlap::ProcessStateChanged()
 
 void UMounteaInteractorComponentOverlap::ProcessOverlap_Server_Implementation(UPrimitiveComponent* OverlappedComponent,AActor* OtherActor, UPrimitiveComponent* OtherComp, const FHitResult& SweepResult, const bool bOverlapStarted)
 {
+	// End of Overlap is never dropped, so Interactable cannot stay found
+	if (bOverlapStarted && !ConsumeServerRPCToken(EMounteaServerRPCType::ESRT_Overlap)) return;
+
 	ProcessOverlap(OverlappedComponent, OtherActor, OtherComp, SweepResult, bOverlapStarted);
 }
 
 void UMounteaInteractorComponentOverlap::SetupInteractorOverlap()
 {
-	for (auto Itr : OverrideCollisionComponents)
+	for (const auto& Itr : UMounteaInteractionSystemBFL::FindPrimitivesByNameOrTag(OverrideCollisionComponents, GetOwner()))
 	{
-		if (auto Comp = UMounteaInteractionSystemBFL::FindPrimitiveByName(Itr, GetOwner()))
-			AddCollisionComponent(Comp);
-		else
-		{
-			Comp = UMounteaInteractionSystemBFL::FindPrimitiveByTag(Itr, GetOwner());
-			 if (Comp)
-			 	AddCollisionComponent(Comp);
-		}
+		if (Itr)
+			AddCollisionComponent(Itr);
 	}
 }
 
@@ -249,24 +246,26 @@ void UMounteaInteractorComponentOverlap::HandleStartOverlap(UPrimitiveComponent*
 	TArray<UActorComponent*> interactableComponents = OtherActor->GetComponentsByInterface(UMounteaInteractableInterface::StaticClass());
 	int32 highestWeight = -1;
 
+	const ECollisionChannel responseChannel = FMounteaInteractorDispatch::GetResponseChannel(this);
+
 	for (const auto& Component : interactableComponents)
 	{
 		TScriptInterface<IMounteaInteractableInterface> InteractableComponent = TScriptInterface<IMounteaInteractableInterface>(Component);
 
-		if (!InteractableComponent->Execute_CanBeTriggered(Component))
+		if (!FMounteaInteractableDispatch::CanBeTriggered(Component))
 			continue;
 
-		ECollisionChannel componentCollisionChannel = InteractableComponent->Execute_GetCollisionChannel(Component);
-		if (componentCollisionChannel != Execute_GetResponseChannel(this))
+		if (FMounteaInteractableDispatch::IsInteractorIgnored(Component, this))
 			continue;
 
-		if (PrimitiveComponent->GetCollisionResponseToChannel(componentCollisionChannel) == ECR_Ignore)
+		ECollisionChannel componentCollisionChannel = FMounteaInteractableDispatch::GetCollisionChannel(Component);
+		if (componentCollisionChannel != responseChannel)
 			continue;
 
-		if (!InteractableComponent->Execute_CanBeTriggered(InteractableComponent.GetObject()))
+		if (PrimitiveComponent->GetCollisionResponseToChannel(componentCollisionChannel) == ECR_Ignore)
 			continue;
 
-		int32 ComponentWeight = InteractableComponent->Execute_GetInteractableWeight(Component);
+		int32 ComponentWeight = FMounteaInteractableDispatch::GetInteractableWeight(Component);
 		if (ComponentWeight > highestWeight)
 		{
 			highestWeight = ComponentWeight;
@@ -298,11 +297,11 @@ void UMounteaInteractorComponentOverlap::HandleStartOverlap(UPrimitiveComponent*
 	if (!Execute_PerformSafetyTrace(this, OtherActor))
 		return;
 	
-	OnInteractableLost.Broadcast(currentlyActiveInteractable);
-	OnInteractableFound.Broadcast(tempInteractable);
+	MounteaInteractionEvents::Broadcast(OnInteractableLostNative, OnInteractableLost, currentlyActiveInteractable);
+	MounteaInteractionEvents::Broadcast(OnInteractableFoundNative, OnInteractableFound, tempInteractable);
 
-	tempInteractable->GetOnInteractorOverlappedHandle().Broadcast(PrimitiveComponent, OtherActor, OtherComp, 0, false, HitResult);
-	tempInteractable->GetOnInteractorFoundHandle().Broadcast(this);
+	tempInteractable->BroadcastInteractorOverlapped(PrimitiveComponent, OtherActor, OtherComp, 0, false, HitResult);
+	tempInteractable->BroadcastInteractorFound(this);
 }
 
 void UMounteaInteractorComponentOverlap::HandleEndOverlap(UPrimitiveComponent* PrimitiveComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp)
@@ -375,14 +374,16 @@ void UMounteaInteractorComponentOverlap::HandleEndOverlap(UPrimitiveComponent* P
 		return;
 	}
 	
-	OnInteractableLost.Broadcast(currentlyActiveInteractable);
+	MounteaInteractionEvents::Broadcast(OnInteractableLostNative, OnInteractableLost, currentlyActiveInteractable);
 	
-	currentlyActiveInteractable->GetOnInteractorStopOverlapHandle().Broadcast(PrimitiveComponent, OtherActor, OtherComp, 0);
-	currentlyActiveInteractable->GetOnInteractorLostHandle().Broadcast(this);
+	currentlyActiveInteractable->BroadcastInteractorStopOverlap(PrimitiveComponent, OtherActor, OtherComp, 0);
+	currentlyActiveInteractable->BroadcastInteractorLost(this);
 }
 
 void UMounteaInteractorComponentOverlap::StartInteractorOverlap_Server_Implementation(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
+	if (!ConsumeServerRPCToken(EMounteaServerRPCType::ESRT_Overlap)) return;
+
 	StartInteractorOverlap(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex, bFromSweep, SweepResult);
 }
 
@@ -407,7 +408,7 @@ void UMounteaInteractorComponentOverlap::AddCollisionComponent_Implementation(UP
 
 		CollisionShapes.Add(CollisionComponent);
 
-		OnCollisionShapeAdded.Broadcast(CollisionComponent);
+		MounteaInteractionEvents::Broadcast(OnCollisionShapeAddedNative, OnCollisionShapeAdded, CollisionComponent);
 
 		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractorComponentOverlap, CollisionShapes, this);
 	}
@@ -435,7 +436,7 @@ void UMounteaInteractorComponentOverlap::AddCollisionComponents_Implementation(c
 
 			CollisionShapes.Add(Itr);
 
-			OnCollisionShapeAdded.Broadcast(Itr);
+			MounteaInteractionEvents::Broadcast(OnCollisionShapeAddedNative, OnCollisionShapeAdded, Itr);
 		}
 
 		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractorComponentOverlap, CollisionShapes, this);
@@ -462,7 +463,7 @@ void UMounteaInteractorComponentOverlap::RemoveCollisionComponent_Implementation
 
 		CollisionShapes.Remove(CollisionComponent);
 
-		OnCollisionShapeRemoved.Broadcast(CollisionComponent);
+		MounteaInteractionEvents::Broadcast(OnCollisionShapeRemovedNative, OnCollisionShapeRemoved, CollisionComponent);
 
 		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractorComponentOverlap, CollisionShapes, this);
 	}
@@ -490,7 +491,7 @@ void UMounteaInteractorComponentOverlap::RemoveCollisionComponents_Implementatio
 
 			CollisionShapes.Remove(Itr);
 
-			OnCollisionShapeRemoved.Broadcast(Itr);
+			MounteaInteractionEvents::Broadcast(OnCollisionShapeRemovedNative, OnCollisionShapeRemoved, Itr);
 		}
 
 		MARK_PROPERTY_DIRTY_FROM_NAME(UMounteaInteractorComponentOverlap, CollisionShapes, this);
@@ -503,22 +504,45 @@ void UMounteaInteractorComponentOverlap::RemoveCollisionComponents_Implementatio
 
 void UMounteaInteractorComponentOverlap::AddCollisionComponent_Server_Implementation(UPrimitiveComponent* CollisionComponent)
 {
-	AddCollisionComponent(CollisionComponent);
+	if (!CollisionComponent) return;
+
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_Config, FName(TEXT("CollisionComponent"), CollisionComponent->GetUniqueID()), [this, WeakComponent = TWeakObjectPtr<UPrimitiveComponent>(CollisionComponent)]()
+	{
+		if (UPrimitiveComponent* Component = WeakComponent.Get())
+		{
+			AddCollisionComponent(Component);
+		}
+	});
 }
 
 void UMounteaInteractorComponentOverlap::AddCollisionComponents_Server_Implementation(const TArray<UPrimitiveComponent*>& CollisionComponents)
 {
-	AddCollisionComponents(CollisionComponents);
+	// Each Component keeps only its latest request
+	for (UPrimitiveComponent* Itr : CollisionComponents)
+	{
+		AddCollisionComponent_Server_Implementation(Itr);
+	}
 }
 
 void UMounteaInteractorComponentOverlap::RemoveCollisionComponent_Server_Implementation(UPrimitiveComponent* CollisionComponent)
 {
-	RemoveCollisionComponent(CollisionComponent);
+	if (!CollisionComponent) return;
+
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_Config, FName(TEXT("CollisionComponent"), CollisionComponent->GetUniqueID()), [this, WeakComponent = TWeakObjectPtr<UPrimitiveComponent>(CollisionComponent)]()
+	{
+		if (UPrimitiveComponent* Component = WeakComponent.Get())
+		{
+			RemoveCollisionComponent(Component);
+		}
+	});
 }
 
 void UMounteaInteractorComponentOverlap::RemoveCollisionComponents_Server_Implementation(const TArray<UPrimitiveComponent*>& CollisionComponents)
 {
-	RemoveCollisionComponents(CollisionComponents);
+	for (UPrimitiveComponent* Itr : CollisionComponents)
+	{
+		RemoveCollisionComponent_Server_Implementation(Itr);
+	}
 }
 
 TArray<UPrimitiveComponent*> UMounteaInteractorComponentOverlap::GetCollisionComponents() const
@@ -27,7 +27,14 @@ UMounteaInteractorComponentTrace::UMounteaInteractorComponentTrace() :
 		TraceInterval(0.1f),
 		TraceRange(250.f),
 		TraceShapeHalfSize(5.f),
-		bUseCustomStartTransform(false)
+		bUseCustomStartTransform(false),
+		bTracingDataFlushPending(false),
+		PendingTracingDataFields(EMounteaTracingDataFields::None),
+		RequestedTracingDataFields(EMounteaTracingDataFields::None),
+		TraceOriginSendInterval(0.f),
+		LastTraceOriginSendTime(-1.f),
+		LastSentTraceOriginLocation(FVector::ZeroVector),
+		LastSentTraceOriginRotation(0)
 {
 	ComponentTags.Add(FName("Trace"));
 	
@@ -36,17 +43,8 @@ UMounteaInteractorComponentTrace::UMounteaInteractorComponentTrace() :
 
 void UMounteaInteractorComponentTrace::BeginPlay()
 {
-	{
-		FTracingData NewData;
-		NewData.TracingType = TraceType;
-		NewData.TracingInterval = TraceInterval;
-		NewData.TracingRange = TraceRange;
-		NewData.TracingShapeHalfSize = TraceShapeHalfSize;
-		NewData.bUsingCustomStartTransform = bUseCustomStartTransform;
-		NewData.CustomTracingTransform = CustomTraceTransform;
-
-		LastTracingData = NewData;
-	}
+	bTracingDataFlushPending = false;
+	LastTracingData = GetPendingTracingData();
 	
 	Super::BeginPlay();
 }
@@ -188,6 +186,11 @@ void UMounteaInteractorComponentTrace::ProcessTrace_Implementation()
 		FVector DirectionVector;
 		if (bUseCustomStartTransform)
 		{
+			if (TraceOriginComponent)
+			{
+				WriteTraceOrigin(GetCustomTraceStart());
+			}
+			
 			TraceData.StartLocation = CustomTraceTransform.GetLocation();
 			TraceData.TraceRotation = CustomTraceTransform.GetRotation().Rotator();
 			DirectionVector = UKismetMathLibrary::GetForwardVector(TraceData.TraceRotation);
@@ -224,8 +227,19 @@ void UMounteaInteractorComponentTrace::ProcessTrace_Implementation()
 	bool bAnyInteractable = false;
 	bool bFoundActiveAgain = false;
 
+	// Handles are compared instead of dispatching GetActiveInteractable for every hit
+	const FMounteaInteractableHandle activeInteractableHandle = GetActiveInteractableHandle();
+
+	const ECollisionChannel responseChannel = FMounteaInteractorDispatch::GetResponseChannel(this);
+
+	// Key compiled from Blueprint overrides would not match what they return
+	const bool bNativeFilterKey = CanDispatchNatively(EMounteaInteractorNativeFunction::GetResponseChannel);
+	const FMounteaInteractionFilterKey interactorFilterKey = bNativeFilterKey ? GetFilterKey() : FMounteaInteractionFilterKey::MakeInteractor(responseChannel, InteractorTag);
+
 	FHitResult BestHitResult;
 	TScriptInterface<IMounteaInteractableInterface> bestFoundInteractable = nullptr;
+	FMounteaInteractableHandle bestFoundInteractableHandle;
+	int32 bestFoundInteractableWeight = -1;
 
 	for (FHitResult& HitResult : TraceData.HitResults)
 	{
@@ -249,33 +263,38 @@ void UMounteaInteractorComponentTrace::ProcessTrace_Implementation()
 			if (!localInteractable.GetObject() || !localInteractable.GetInterface())
 				continue;
 
-			if (!localInteractable->Execute_GetCollisionComponents(Itr).Contains(HitResult.GetComponent()))
+			if (!FMounteaInteractableDispatch::GetCollisionComponents(Itr).Contains(HitResult.GetComponent()))
 				continue;
 
-			if (localInteractable->Execute_GetCollisionChannel(Itr) != Execute_GetResponseChannel(this))
-				continue;
-
-			if (!localInteractable->Execute_CanBeTriggered(Itr))
+			if (!FMounteaInteractableDispatch::IsCompatible(Itr, interactorFilterKey, responseChannel, InteractorTag))
 			{
-				if (localInteractable->Execute_GetInteractor(Itr) != this)
-					continue;
+				// Only Tag mismatch of Interactables which could be triggered is reported, other Collision Channels are expected
+				const bool bTriggerable = FMounteaInteractableDispatch::CanBeTriggered(Itr) || FMounteaInteractableDispatch::GetInteractor(Itr) == this;
+				if (bTriggerable && InteractorTag.IsValid() && FMounteaInteractableDispatch::GetCollisionChannel(Itr) == responseChannel)
+				{
+					LOG_WARNING(TEXT("[ProcessTrace] Interactor Tag %s is not compatible with %s Interactable on %s Actor"), *InteractorTag.ToString(), *FMounteaInteractableDispatch::GetInteractableName(Itr).ToString(), *HitActor->GetName())
+				}
+				continue;
 			}
 
-			if (InteractorTag.IsValid() && !localInteractable->Execute_GetInteractableCompatibleTags(Itr).HasTag(InteractorTag))
-			{
-				LOG_WARNING(TEXT("[ProcessTrace] Interactor Tag %s is not compatible with %s Interactable on %s Actor"), *InteractorTag.ToString(), *localInteractable->Execute_GetInteractableName(Itr).ToString(), *HitActor->GetName())
+			if (FMounteaInteractableDispatch::IsInteractorIgnored(Itr, this))
 				continue;
+
+			if (!FMounteaInteractableDispatch::CanBeTriggered(Itr))
+			{
+				if (FMounteaInteractableDispatch::GetInteractor(Itr) != this)
+					continue;
 			}
 
 			bAnyInteractable = true;
 
-			if (localInteractable == Execute_GetActiveInteractable(this))
+			const FMounteaInteractableHandle localInteractableHandle = FMounteaInteractableHandle::Get(Itr);
+			if (localInteractableHandle == activeInteractableHandle)
 			{
 				bFoundActiveAgain = true;
 			}
 
-			const float localInteractableWeight = localInteractable->Execute_GetInteractableWeight(Itr);
-			const float bestFoundInteractableWeight = bestFoundInteractable != nullptr ? bestFoundInteractable->Execute_GetInteractableWeight(bestFoundInteractable.GetObject()) : -1.f;
+			const int32 localInteractableWeight = FMounteaInteractableDispatch::GetInteractableWeight(Itr);
 
 			if (bestFoundInteractable == nullptr || localInteractableWeight > bestFoundInteractableWeight)
 			{
@@ -286,26 +305,26 @@ void UMounteaInteractorComponentTrace::ProcessTrace_Implementation()
 				}
 				
 				bestFoundInteractable = localInteractable;
+				bestFoundInteractableHandle = localInteractableHandle;
+				bestFoundInteractableWeight = localInteractableWeight;
 				BestHitResult = HitResult;
 			}
 		}
 	}
 
-	if (bestFoundInteractable != Execute_GetActiveInteractable(this))
+	if (bestFoundInteractableHandle != activeInteractableHandle)
 	{
-		if (Execute_GetActiveInteractable(this) != nullptr)
+		const TScriptInterface<IMounteaInteractableInterface> activeInteractable = activeInteractableHandle.GetInterface();
+		if (activeInteractable.GetObject() != nullptr)
 		{
-			if (!bAnyInteractable || Execute_GetActiveInteractable(this) != bestFoundInteractable)
-			{
-				OnInteractableLost.Broadcast(Execute_GetActiveInteractable(this));
-			}
+			MounteaInteractionEvents::Broadcast(OnInteractableLostNative, OnInteractableLost, activeInteractable);
 		}
 
-		if (bAnyInteractable && Execute_GetActiveInteractable(this) != bestFoundInteractable)
+		if (bAnyInteractable)
 		{
-			OnInteractableFound.Broadcast(bestFoundInteractable);
-			bestFoundInteractable->GetOnInteractorTracedHandle().Broadcast(BestHitResult.GetComponent(), GetOwner(), nullptr, BestHitResult.Location, BestHitResult);
-			bestFoundInteractable->GetOnInteractorFoundHandle().Broadcast(this);
+			MounteaInteractionEvents::Broadcast(OnInteractableFoundNative, OnInteractableFound, bestFoundInteractable);
+			bestFoundInteractable->BroadcastInteractorTraced(BestHitResult.GetComponent(), GetOwner(), nullptr, BestHitResult.Location, BestHitResult);
+			bestFoundInteractable->BroadcastInteractorFound(this);
 		}
 	}
 
@@ -361,218 +380,399 @@ EMounteaTraceType UMounteaInteractorComponentTrace::GetTraceType() const
 
 void UMounteaInteractorComponentTrace::SetTraceType_Implementation(const EMounteaTraceType& NewTraceType)
 {
-	if (!GetOwner())
-	{
-		LOG_ERROR(TEXT("[SetTraceType] No owner!"));
-		return;
-	}
+	FTracingData NewData = GetPendingTracingData();
+	NewData.TracingType = NewTraceType;
 
-	if (GetOwner()->HasAuthority())
-	{
-		const FTracingData OldData = GetLastTracingData();
-		FTracingData NewData = GetLastTracingData();
-		NewData.TracingType = NewTraceType;
-
-		LastTracingData = NewData;
-		
-		TraceType = NewTraceType;
-		OnTraceDataChanged.Broadcast(NewData, OldData);
-	}
-	else
-	{
-		SetTraceType_Server(NewTraceType);
-	}
+	QueueTracingData(NewData, EMounteaTracingDataFields::Type);
 }
 
 float UMounteaInteractorComponentTrace::GetTraceInterval() const
 { return TraceInterval; }
 
 void UMounteaInteractorComponentTrace::SetTraceInterval_Implementation(const float NewInterval)
+{
+	FTracingData NewData = GetPendingTracingData();
+	NewData.TracingInterval = NewInterval;
+
+	QueueTracingData(NewData, EMounteaTracingDataFields::Interval);
+}
+
+float UMounteaInteractorComponentTrace::GetTraceRange() const
+{ return TraceRange; }
+
+void UMounteaInteractorComponentTrace::SetTraceRange_Implementation(const float NewRange)
+{
+	FTracingData NewData = GetPendingTracingData();
+	NewData.TracingRange = NewRange;
+
+	QueueTracingData(NewData, EMounteaTracingDataFields::Range);
+}
+
+float UMounteaInteractorComponentTrace::GetTraceShapeHalfSize() const
+{ return TraceShapeHalfSize; }
+
+void UMounteaInteractorComponentTrace::SetTraceShapeHalfSize_Implementation(const float NewTraceShapeHalfSize)
+{
+	FTracingData NewData = GetPendingTracingData();
+	NewData.TracingShapeHalfSize = NewTraceShapeHalfSize;
+
+	QueueTracingData(NewData, EMounteaTracingDataFields::ShapeHalfSize);
+}
+
+bool UMounteaInteractorComponentTrace::GetUseCustomStartTransform() const
+{ return bUseCustomStartTransform; }
+
+void UMounteaInteractorComponentTrace::SetUseCustomStartTransform_Implementation(const bool bUse)
+{
+	FTracingData NewData = GetPendingTracingData();
+	NewData.bUsingCustomStartTransform = bUse;
+
+	QueueTracingData(NewData, EMounteaTracingDataFields::CustomStart);
+}
+
+FTracingData UMounteaInteractorComponentTrace::GetLastTracingData() const
+{ return LastTracingData; }
+
+void UMounteaInteractorComponentTrace::SetCustomTraceStart_Implementation(const FTransform& TraceStart)
 {
 	if (!GetOwner())
 	{
-		LOG_ERROR(TEXT("[SetTraceInterval] No owner!"));
+		LOG_ERROR(TEXT("[SetCustomTraceStart] No owner!"));
 		return;
 	}
 
+	// Origin Component is resolved on Server, nothing to send
+	if (TraceOriginComponent) return;
+
+	CustomTraceTransform = TraceStart;
+
 	if (GetOwner()->HasAuthority())
 	{
-		const FTracingData OldData = GetLastTracingData();
-		FTracingData NewData = GetLastTracingData();
-		NewData.TracingInterval = FMath::Max(0.01f, NewInterval);
+		if (bUseCustomStartTransform && GetWorld())
+		{
+			WriteTraceOrigin(TraceStart);
 
-		LastTracingData = NewData;
-		
-		TraceInterval = NewData.TracingInterval;
-		OnTraceDataChanged.Broadcast(NewData, OldData);
+			// Restarted by every update, so Tracing Data change is announced only once the value settles
+			GetWorld()->GetTimerManager().SetTimer(Timer_TraceOriginSettle, this, &UMounteaInteractorComponentTrace::CommitSettledTraceOrigin, GetTraceOriginSendInterval(), false);
+		}
+		return;
+	}
+
+	if (!GetPendingTracingData().bUsingCustomStartTransform || !GetWorld()) return;
+
+	// Trailing value is sent once the interval passes
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	if (TimerManager.IsTimerActive(Timer_TraceOriginSend)) return;
+
+	const float SendInterval = GetTraceOriginSendInterval();
+	const float TimeSinceLastSend = GetWorld()->GetTimeSeconds() - LastTraceOriginSendTime;
+	if (LastTraceOriginSendTime < 0.f || TimeSinceLastSend >= SendInterval)
+	{
+		SendTraceOrigin();
 	}
 	else
 	{
-		SetTraceInterval_Server(NewInterval);
+		TimerManager.SetTimer(Timer_TraceOriginSend, this, &UMounteaInteractorComponentTrace::SendTraceOrigin, SendInterval - TimeSinceLastSend, false);
 	}
 }
 
-float UMounteaInteractorComponentTrace::GetTraceRange() const
-{ return TraceRange; }
+FTransform UMounteaInteractorComponentTrace::GetCustomTraceStart() const
+{
+	if (TraceOriginComponent)
+	{
+		return TraceOriginComponent->GetSocketTransform(TraceOriginSocketName);
+	}
+	return CustomTraceTransform;
+}
 
-void UMounteaInteractorComponentTrace::SetTraceRange_Implementation(const float NewRange)
+void UMounteaInteractorComponentTrace::SetTraceOriginComponent_Implementation(USceneComponent* NewOriginComponent, const FName& NewOriginSocketName)
 {
 	if (!GetOwner())
 	{
-		LOG_ERROR(TEXT("[SetTraceRange] No owner!"));
+		LOG_ERROR(TEXT("[SetTraceOriginComponent] No owner!"));
 		return;
 	}
 
 	if (GetOwner()->HasAuthority())
 	{
-		const FTracingData OldData = GetLastTracingData();
-		FTracingData NewData = GetLastTracingData();
-		NewData.TracingRange = FMath::Max(1.f, NewRange);
-
-		LastTracingData = NewData;
-		
-		TraceRange = NewData.TracingRange;
-		OnTraceDataChanged.Broadcast(NewData, OldData);
+		TraceOriginComponent = NewOriginComponent;
+		TraceOriginSocketName = NewOriginSocketName;
 	}
 	else
 	{
-		SetTraceRange_Server(NewRange);
+		SetTraceOriginComponent_Server(NewOriginComponent, NewOriginSocketName);
 	}
 }
 
-float UMounteaInteractorComponentTrace::GetTraceShapeHalfSize() const
-{ return TraceShapeHalfSize; }
-
-void UMounteaInteractorComponentTrace::SetTraceShapeHalfSize_Implementation(const float NewTraceShapeHalfSize)
+void UMounteaInteractorComponentTrace::ApplyTracingData_Implementation(const FTracingData& NewTracingData)
 {
 	if (!GetOwner())
 	{
-		LOG_ERROR(TEXT("[SetTraceShapeHalfSize] No owner!"));
+		LOG_ERROR(TEXT("[ApplyTracingData] No owner!"));
 		return;
 	}
 
+	// Explicit apply supersedes anything collected from Setters
+	bTracingDataFlushPending = false;
+	PendingTracingDataFields = EMounteaTracingDataFields::None;
+
 	if (GetOwner()->HasAuthority())
 	{
-		const FTracingData OldData = GetLastTracingData();
-		FTracingData NewData = GetLastTracingData();
-		NewData.TracingShapeHalfSize = FMath::Max(0.1f, NewTraceShapeHalfSize);
+		FTracingData NewData = NewTracingData;
+		NewData.Validate();
+		
+		WriteTracingData(NewData);
 
+		const FTracingData OldData = GetLastTracingData();
 		LastTracingData = NewData;
-		
-		TraceShapeHalfSize = NewData.TracingShapeHalfSize;
-		OnTraceDataChanged.Broadcast(NewData, OldData);
+
+		if (NewData != OldData)
+		{
+			MounteaInteractionEvents::Broadcast(OnTraceDataChangedNative, OnTraceDataChanged, NewData, OldData);
+		}
 	}
 	else
 	{
-		SetTraceShapeHalfSize_Server(NewTraceShapeHalfSize);
+		// Next Custom Trace Start is sent reliably, so it is ordered after new Tracing Data
+		LastTraceOriginSendTime = -1.f;
+		
+		ApplyTracingData_Server(NewTracingData, static_cast<uint8>(EMounteaTracingDataFields::All));
 	}
 }
 
-bool UMounteaInteractorComponentTrace::GetUseCustomStartTransform() const
-{ return bUseCustomStartTransform; }
+FTracingData UMounteaInteractorComponentTrace::GetPendingTracingData() const
+{
+	if (bTracingDataFlushPending)
+	{
+		return PendingTracingData;
+	}
+	
+	FTracingData CurrentData;
+	CurrentData.TracingType = TraceType;
+	CurrentData.TracingInterval = TraceInterval;
+	CurrentData.TracingRange = TraceRange;
+	CurrentData.TracingShapeHalfSize = TraceShapeHalfSize;
+	CurrentData.bUsingCustomStartTransform = bUseCustomStartTransform;
+	CurrentData.CustomTracingTransform = CustomTraceTransform;
+	
+	return CurrentData;
+}
 
-void UMounteaInteractorComponentTrace::SetUseCustomStartTransform_Implementation(const bool bUse)
+void UMounteaInteractorComponentTrace::QueueTracingData(const FTracingData& NewTracingData, const EMounteaTracingDataFields ChangedFields)
 {
 	if (!GetOwner())
 	{
-		LOG_ERROR(TEXT("[SetUseCustomStartTransform] No owner!"));
+		LOG_ERROR(TEXT("[QueueTracingData] No owner!"));
 		return;
 	}
 
+	PendingTracingData = NewTracingData;
+	PendingTracingData.Validate();
+	PendingTracingDataFields |= ChangedFields;
+
+	// Server values must be readable right away
 	if (GetOwner()->HasAuthority())
 	{
-		const FTracingData OldData = GetLastTracingData();
-		FTracingData NewData = GetLastTracingData();
-		NewData.bUsingCustomStartTransform = bUse;
-		
-		bUseCustomStartTransform = bUse;
-
-		LastTracingData = NewData;
-		OnTraceDataChanged.Broadcast(NewData, OldData);
+		WriteTracingData(PendingTracingData);
 	}
-	else
+
+	if (bTracingDataFlushPending) return;
+
+	if (!GetWorld())
 	{
-		SetUseCustomStartTransform_Server(bUse);
+		ApplyTracingData(PendingTracingData);
+		return;
 	}
-}
 
-FTracingData UMounteaInteractorComponentTrace::GetLastTracingData() const
-{ return LastTracingData; }
+	bTracingDataFlushPending = true;
+	GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UMounteaInteractorComponentTrace::FlushTracingData);
+}
 
-void UMounteaInteractorComponentTrace::SetCustomTraceStart_Implementation(const FTransform& TraceStart)
+void UMounteaInteractorComponentTrace::FlushTracingData()
 {
-	if (!GetOwner())
+	if (!bTracingDataFlushPending) return;
+
+	// Client sends only values changed by Setters, others might be outdated
+	if (GetOwner() && !GetOwner()->HasAuthority())
 	{
-		LOG_ERROR(TEXT("[SetCustomTraceStart] No owner!"));
+		const EMounteaTracingDataFields ChangedFields = PendingTracingDataFields;
+		bTracingDataFlushPending = false;
+		PendingTracingDataFields = EMounteaTracingDataFields::None;
+
+		// Next Custom Trace Start is sent reliably, so it is ordered after new Tracing Data
+		LastTraceOriginSendTime = -1.f;
+		
+		ApplyTracingData_Server(PendingTracingData, static_cast<uint8>(ChangedFields));
 		return;
 	}
+	
+	ApplyTracingData(PendingTracingData);
+}
 
-	if (GetOwner()->HasAuthority())
+void UMounteaInteractorComponentTrace::WriteTracingData(const FTracingData& NewTracingData)
+{
+	TraceType = NewTracingData.TracingType;
+	TraceInterval = NewTracingData.TracingInterval;
+	TraceRange = NewTracingData.TracingRange;
+	TraceShapeHalfSize = NewTracingData.TracingShapeHalfSize;
+	bUseCustomStartTransform = NewTracingData.bUsingCustomStartTransform;
+
+	if (bUseCustomStartTransform && !TraceOriginComponent)
 	{
-		if (bUseCustomStartTransform)
-		{
-			const FTracingData OldData = GetLastTracingData();
-			FTracingData NewData = GetLastTracingData();
-			NewData.CustomTracingTransform = TraceStart;
-			
-			CustomTraceTransform = TraceStart;
+		WriteTraceOrigin(NewTracingData.CustomTracingTransform);
+	}
+}
 
-			LastTracingData = NewData;
-			OnTraceDataChanged.Broadcast(NewData, OldData);
+void UMounteaInteractorComponentTrace::WriteTraceOrigin(const FTransform& TraceStart)
+{
+	CustomTraceTransform = TraceStart;
 
-			switch (SafetyTraceSetup.SafetyTracingMode)
-			{
-				case ESafetyTracingMode::ESTM_Location:
-					SafetyTraceSetup.StartLocation = NewData.CustomTracingTransform.GetLocation();
-				case ESafetyTracingMode::ESTM_Socket:
-				case ESafetyTracingMode::ESTM_None:
-				default:
-					break;
-			}
-		}
+	switch (SafetyTraceSetup.SafetyTracingMode)
+	{
+		case ESafetyTracingMode::ESTM_Location:
+			SafetyTraceSetup.StartLocation = CustomTraceTransform.GetLocation();
+			break;
+		case ESafetyTracingMode::ESTM_Socket:
+		case ESafetyTracingMode::ESTM_None:
+		default:
+			break;
 	}
-	else
+}
+
+void UMounteaInteractorComponentTrace::SendTraceOrigin()
+{
+	if (!GetWorld()) return;
+
+	const FVector_NetQuantize10 TraceStartLocation = CustomTraceTransform.GetLocation();
+	
+	const FRotator TraceStartRotation = CustomTraceTransform.Rotator();
+	const uint32 PackedTraceStartRotation = (static_cast<uint32>(FRotator::CompressAxisToShort(TraceStartRotation.Pitch)) << 16) | FRotator::CompressAxisToShort(TraceStartRotation.Yaw);
+
+	// Compare quantized values, so tiny jitter does not cause any traffic
+	const bool bFirstSend = LastTraceOriginSendTime < 0.f;
+	const bool bLocationChanged = !TraceStartLocation.Equals(LastSentTraceOriginLocation, 0.1f);
+	if (!bFirstSend && !bLocationChanged && PackedTraceStartRotation == LastSentTraceOriginRotation) return;
+
+	LastTraceOriginSendTime = GetWorld()->GetTimeSeconds();
+	LastSentTraceOriginLocation = TraceStartLocation;
+	LastSentTraceOriginRotation = PackedTraceStartRotation;
+
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	if (bFirstSend)
 	{
-		SetCustomTraceStart_Server(TraceStart);
+		TimerManager.ClearTimer(Timer_TraceOriginSettle);
+		SetSettledCustomTraceStart_Server(TraceStartLocation, PackedTraceStartRotation);
+		return;
 	}
+	
+	SetCustomTraceStart_Server(TraceStartLocation, PackedTraceStartRotation);
+
+	// Restarted by every update, so it fires only once the value settles
+	TimerManager.SetTimer(Timer_TraceOriginSettle, this, &UMounteaInteractorComponentTrace::SendSettledTraceOrigin, GetTraceOriginSendInterval(), false);
 }
 
-FTransform UMounteaInteractorComponentTrace::GetCustomTraceStart() const
-{ return CustomTraceTransform; }
+void UMounteaInteractorComponentTrace::SendSettledTraceOrigin()
+{
+	SetSettledCustomTraceStart_Server(LastSentTraceOriginLocation, LastSentTraceOriginRotation);
+}
 
-void UMounteaInteractorComponentTrace::PostTraced_Implementation()
+void UMounteaInteractorComponentTrace::CommitSettledTraceOrigin()
 {
-	OnTraced.Broadcast();
+	if (!bUseCustomStartTransform || TraceOriginComponent) return;
+
+	CommitTraceOrigin(CustomTraceTransform);
 }
 
-void UMounteaInteractorComponentTrace::SetTraceType_Server_Implementation(const EMounteaTraceType& NewTraceType)
+void UMounteaInteractorComponentTrace::CommitTraceOrigin(const FTransform& TraceStart)
 {
-	SetTraceType(NewTraceType);
+	WriteTraceOrigin(TraceStart);
+
+	const FTracingData OldData = GetLastTracingData();
+	FTracingData NewData = OldData;
+	NewData.CustomTracingTransform = CustomTraceTransform;
+	LastTracingData = NewData;
+
+	if (NewData != OldData)
+	{
+		MounteaInteractionEvents::Broadcast(OnTraceDataChangedNative, OnTraceDataChanged, NewData, OldData);
+	}
 }
 
-void UMounteaInteractorComponentTrace::SetTraceInterval_Server_Implementation(float NewInterval)
+float UMounteaInteractorComponentTrace::GetTraceRPCRate() const
 {
-	SetTraceInterval(NewInterval);
+	// Trace requests plus Trace Origin updates, doubled to absorb network jitter
+	const float SendInterval = GetTraceOriginSendInterval();
+	return 2.f * (1.f / FMath::Max(0.01f, TraceInterval) + 1.f / FMath::Max(0.01f, SendInterval));
 }
 
-void UMounteaInteractorComponentTrace::SetTraceRange_Server_Implementation(float NewRange)
+void UMounteaInteractorComponentTrace::PostTraced_Implementation()
 {
-	SetTraceRange(NewRange);
+	MounteaInteractionEvents::Broadcast(OnTracedNative, OnTraced);
 }
 
-void UMounteaInteractorComponentTrace::SetTraceShapeHalfSize_Server_Implementation(float NewTraceShapeHalfSize)
+void UMounteaInteractorComponentTrace::SetCustomTraceStart_Server_Implementation(const FVector_NetQuantize10& TraceStartLocation, const uint32 PackedTraceStartRotation)
 {
-	SetTraceShapeHalfSize(NewTraceShapeHalfSize);
+	if (!ConsumeServerRPCToken(EMounteaServerRPCType::ESRT_Trace, GetTraceRPCRate())) return;
+
+	// Streamed value only moves the origin, Tracing Data change is announced by the settled one
+	ReceiveTraceOrigin(TraceStartLocation, PackedTraceStartRotation, false);
 }
 
-void UMounteaInteractorComponentTrace::SetUseCustomStartTransform_Server_Implementation(bool bUse)
+void UMounteaInteractorComponentTrace::SetSettledCustomTraceStart_Server_Implementation(const FVector_NetQuantize10& TraceStartLocation, const uint32 PackedTraceStartRotation)
 {
-	SetUseCustomStartTransform(bUse);
+	if (!ConsumeServerRPCToken(EMounteaServerRPCType::ESRT_Trace, GetTraceRPCRate())) return;
+
+	ReceiveTraceOrigin(TraceStartLocation, PackedTraceStartRotation, true);
 }
 
-void UMounteaInteractorComponentTrace::SetCustomTraceStart_Server_Implementation(const FTransform& TraceStart)
+void UMounteaInteractorComponentTrace::ReceiveTraceOrigin(const FVector_NetQuantize10& TraceStartLocation, const uint32 PackedTraceStartRotation, const bool bSettled)
 {
-	SetCustomTraceStart(TraceStart);
+	if (!bUseCustomStartTransform || TraceOriginComponent) return;
+	
+	const FRotator TraceStartRotation
+	(
+		FRotator::DecompressAxisFromShort(static_cast<uint16>(PackedTraceStartRotation >> 16)),
+		FRotator::DecompressAxisFromShort(static_cast<uint16>(PackedTraceStartRotation & 0xFFFF)),
+		0.f
+	);
+	const FTransform TraceStart(TraceStartRotation, TraceStartLocation);
+	
+	if (bSettled)
+	{
+		CommitTraceOrigin(TraceStart);
+	}
+	else
+	{
+		WriteTraceOrigin(TraceStart);
+	}
+}
+
+void UMounteaInteractorComponentTrace::SetTraceOriginComponent_Server_Implementation(USceneComponent* NewOriginComponent, const FName& NewOriginSocketName)
+{
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_Config, TEXT("TraceOriginComponent"), [this, WeakComponent = TWeakObjectPtr<USceneComponent>(NewOriginComponent), bHasComponent = NewOriginComponent != nullptr, NewOriginSocketName]()
+	{
+		// Component destroyed while waiting is not replaced by none
+		if (bHasComponent && !WeakComponent.IsValid()) return;
+		
+		SetTraceOriginComponent(WeakComponent.Get(), NewOriginSocketName);
+	});
+}
+
+void UMounteaInteractorComponentTrace::ApplyTracingData_Server_Implementation(const FTracingData& NewTracingData, const uint8 ChangedFields)
+{
+	// Requests waiting for budget are merged, so Fields changed by earlier ones are not lost
+	RequestedTracingData.CopyFields(NewTracingData, static_cast<EMounteaTracingDataFields>(ChangedFields));
+	RequestedTracingDataFields |= static_cast<EMounteaTracingDataFields>(ChangedFields);
+
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_Config, TEXT("TracingData"), [this]()
+	{
+		// Values not changed by Client keep what Server has
+		FTracingData MergedData = GetPendingTracingData();
+		MergedData.CopyFields(RequestedTracingData, RequestedTracingDataFields);
+		RequestedTracingDataFields = EMounteaTracingDataFields::None;
+		
+		ApplyTracingData(MergedData);
+	});
 }
 
 void UMounteaInteractorComponentTrace::PostTraced_Client_Implementation()
@@ -630,31 +830,46 @@ void UMounteaInteractorComponentTrace::GetLifetimeReplicatedProps(TArray<FLifeti
 	DOREPLIFETIME_CONDITION(UMounteaInteractorComponentTrace, TraceRange,									COND_OwnerOnly);
 	DOREPLIFETIME_CONDITION(UMounteaInteractorComponentTrace, TraceShapeHalfSize,					COND_OwnerOnly);
 	DOREPLIFETIME_CONDITION(UMounteaInteractorComponentTrace, bUseCustomStartTransform,		COND_OwnerOnly);
-	DOREPLIFETIME_CONDITION(UMounteaInteractorComponentTrace, CustomTraceTransform,				COND_OwnerOnly);
+	DOREPLIFETIME_CONDITION(UMounteaInteractorComponentTrace, TraceOriginComponent,				COND_OwnerOnly);
+	DOREPLIFETIME_CONDITION(UMounteaInteractorComponentTrace, TraceOriginSocketName,			COND_OwnerOnly);
 }
 
 void UMounteaInteractorComponentTrace::DisableTracing_Server_Implementation()
 {
-	DisableTracing();
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_State, TEXT("TracingEnabled"), [this]()
+	{
+		DisableTracing();
+	});
 }
 
 void UMounteaInteractorComponentTrace::EnableTracing_Server_Implementation()
 {
-	EnableTracing();
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_State, TEXT("TracingEnabled"), [this]()
+	{
+		EnableTracing();
+	});
 }
 
 void UMounteaInteractorComponentTrace::PauseTracing_Server_Implementation()
 {
-	PauseTracing();
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_State, TEXT("TracingPaused"), [this]()
+	{
+		PauseTracing();
+	});
 }
 
 void UMounteaInteractorComponentTrace::ResumeTracing_Server_Implementation()
 {
-	ResumeTracing();
+	CoalesceServerRPC(EMounteaServerRPCType::ESRT_State, TEXT("TracingPaused"), [this]()
+	{
+		ResumeTracing();
+	});
 }
 
 void UMounteaInteractorComponentTrace::ProcessTrace_Server_Implementation()
 {
+	if (!ConsumeServerRPCToken(EMounteaServerRPCType::ESRT_Trace, GetTraceRPCRate())) return;
+
 	ProcessTrace();
 }
 
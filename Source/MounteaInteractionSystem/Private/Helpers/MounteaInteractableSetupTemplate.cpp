@@ -0,0 +1,141 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaInteractableSetupTemplate.h"
+
+#include "Components/MeshComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "UObject/ObjectKey.h"
+
+#include "Helpers/MounteaInteractionSystemBFL.h"
+
+namespace MounteaInteractableSetup
+{
+	struct FTemplateKey
+	{
+		TObjectKey<UClass>		OwnerClass;
+		ESetupType					SetupType = ESetupType::EST_Default;
+		TArray<FName>				CollisionOverrides;
+		TArray<FName>				HighlightableOverrides;
+
+		bool operator==(const FTemplateKey& Other) const
+		{
+			return OwnerClass == Other.OwnerClass && SetupType == Other.SetupType && CollisionOverrides == Other.CollisionOverrides && HighlightableOverrides == Other.HighlightableOverrides;
+		}
+
+		friend uint32 GetTypeHash(const FTemplateKey& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.OwnerClass), GetTypeHash(Key.SetupType));
+			for (const FName& Itr : Key.CollisionOverrides)
+			{
+				Hash = HashCombine(Hash, GetTypeHash(Itr));
+			}
+			for (const FName& Itr : Key.HighlightableOverrides)
+			{
+				Hash = HashCombine(Hash, GetTypeHash(Itr));
+			}
+			return Hash;
+		}
+	};
+
+	enum class EOwnerComponents : uint8
+	{
+		ClassDefined,
+		ConstructionScript,
+		Instance
+	};
+
+	EOwnerComponents GetOwnerComponents(const AActor* Owner)
+	{
+		EOwnerComponents Result = EOwnerComponents::ClassDefined;
+		for (const UActorComponent* Itr : Owner->GetComponents())
+		{
+			if (!Itr) continue;
+
+			switch (Itr->CreationMethod)
+			{
+				case EComponentCreationMethod::Instance:
+					return EOwnerComponents::Instance;
+				case EComponentCreationMethod::UserConstructionScript:
+					Result = EOwnerComponents::ConstructionScript;
+					break;
+				default:
+					break;
+			}
+		}
+		return Result;
+	}
+
+	template<typename ComponentType>
+	void GetComponentNames(const AActor* Owner, TArray<FName>& OutNames)
+	{
+		TArray<ComponentType*> Components;
+		Owner->GetComponents(Components);
+
+		for (const ComponentType* Itr : Components)
+		{
+			if (Itr)
+			{
+				OutNames.Add(Itr->GetFName());
+			}
+		}
+	}
+
+	FName GetComponentName(const UActorComponent* Component)
+	{
+		return Component ? Component->GetFName() : NAME_None;
+	}
+}
+
+const FMounteaInteractableSetupTemplate* FMounteaInteractableSetupTemplate::Get(const AActor* Owner, const ESetupType SetupType, const TArray<FName>& CollisionOverrides, const TArray<FName>& HighlightableOverrides)
+{
+	check(IsInGameThread());
+
+	if (!Owner) return nullptr;
+
+	MounteaInteractableSetup::FTemplateKey Key;
+	Key.OwnerClass = Owner->GetClass();
+	Key.SetupType = SetupType;
+	Key.CollisionOverrides = CollisionOverrides;
+	Key.HighlightableOverrides = HighlightableOverrides;
+
+	// Null entry marks Owner Class whose Components might differ per instance
+	static TMap<MounteaInteractableSetup::FTemplateKey, TUniquePtr<FMounteaInteractableSetupTemplate>> Templates;
+	if (const TUniquePtr<FMounteaInteractableSetupTemplate>* ExistingTemplate = Templates.Find(Key))
+	{
+		return ExistingTemplate->Get();
+	}
+
+	switch (MounteaInteractableSetup::GetOwnerComponents(Owner))
+	{
+		case MounteaInteractableSetup::EOwnerComponents::Instance:
+			// Components added to this Owner only, another instance might still build the Template
+			return nullptr;
+		case MounteaInteractableSetup::EOwnerComponents::ConstructionScript:
+			Templates.Add(MoveTemp(Key), nullptr);
+			return nullptr;
+		default:
+			break;
+	}
+
+	TUniquePtr<FMounteaInteractableSetupTemplate> NewTemplate = MakeUnique<FMounteaInteractableSetupTemplate>();
+	NewTemplate->NumOwnerComponents = Owner->GetComponents().Num();
+
+	if (SetupType == ESetupType::EST_FullAll)
+	{
+		MounteaInteractableSetup::GetComponentNames<UPrimitiveComponent>(Owner, NewTemplate->CollisionComponents);
+		MounteaInteractableSetup::GetComponentNames<UMeshComponent>(Owner, NewTemplate->HighlightableComponents);
+	}
+
+	// Only Overrides found by name are shared, tags are resolved per instance
+	for (const FName& Itr : CollisionOverrides)
+	{
+		NewTemplate->CollisionOverrideComponents.Add(MounteaInteractableSetup::GetComponentName(UMounteaInteractionSystemBFL::FindPrimitiveByName(Itr, Owner)));
+	}
+
+	for (const FName& Itr : HighlightableOverrides)
+	{
+		NewTemplate->HighlightableOverrideComponents.Add(MounteaInteractableSetup::GetComponentName(UMounteaInteractionSystemBFL::FindMeshByName(Itr, Owner)));
+	}
+
+	return Templates.Add(MoveTemp(Key), MoveTemp(NewTemplate)).Get();
+}
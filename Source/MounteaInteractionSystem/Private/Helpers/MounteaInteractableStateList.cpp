@@ -0,0 +1,134 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaInteractableStateList.h"
+
+#include "Components/Interactable/MounteaInteractableComponentBase.h"
+
+bool FMounteaInteractableStateSnapshot::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	uint8 SerializedFlags = Flags & static_cast<uint8>(EMounteaInteractableSnapshotFlags::All);
+	Ar.SerializeBits(&SerializedFlags, 5);
+	Flags = SerializedFlags;
+
+	if (HasFlag(EMounteaInteractableSnapshotFlags::State))
+	{
+		uint32 StateValue = static_cast<uint32>(State);
+		Ar.SerializeInt(StateValue, static_cast<uint32>(EInteractableStateV2::Default) + 1);
+		State = static_cast<EInteractableStateV2>(StateValue);
+	}
+
+	if (HasFlag(EMounteaInteractableSnapshotFlags::Lifecycle))
+	{
+		// Infinite Lifecycle is -1, so value is shifted to stay unsigned
+		uint32 LifecycleValue = static_cast<uint32>(FMath::Max(-1, RemainingLifecycleCount) + 1);
+		Ar.SerializeIntPacked(LifecycleValue);
+		RemainingLifecycleCount = static_cast<int32>(LifecycleValue) - 1;
+	}
+
+	if (HasFlag(EMounteaInteractableSnapshotFlags::Data))
+	{
+		UObject* DataTable = const_cast<UDataTable*>(InteractableData.DataTable.Get());
+		bOutSuccess &= Map->SerializeObject(Ar, UDataTable::StaticClass(), DataTable);
+		Ar << InteractableData.RowName;
+
+		if (Ar.IsLoading())
+		{
+			InteractableData.DataTable = Cast<UDataTable>(DataTable);
+		}
+	}
+
+	if (HasFlag(EMounteaInteractableSnapshotFlags::Name))
+	{
+		Ar << InteractableName;
+	}
+
+	if (HasFlag(EMounteaInteractableSnapshotFlags::Tags))
+	{
+		bool bTagsSuccess = true;
+		InteractableCompatibleTags.NetSerialize(Ar, Map, bTagsSuccess);
+		bOutSuccess &= bTagsSuccess;
+	}
+
+	return true;
+}
+
+bool FMounteaInteractableStateSnapshot::operator==(const FMounteaInteractableStateSnapshot& Other) const
+{
+	if (Flags != Other.Flags) return false;
+
+	if (HasFlag(EMounteaInteractableSnapshotFlags::State) && State != Other.State) return false;
+	if (HasFlag(EMounteaInteractableSnapshotFlags::Lifecycle) && RemainingLifecycleCount != Other.RemainingLifecycleCount) return false;
+	if (HasFlag(EMounteaInteractableSnapshotFlags::Data) && InteractableData != Other.InteractableData) return false;
+	if (HasFlag(EMounteaInteractableSnapshotFlags::Name) && !InteractableName.IdenticalTo(Other.InteractableName)) return false;
+	if (HasFlag(EMounteaInteractableSnapshotFlags::Tags) && InteractableCompatibleTags != Other.InteractableCompatibleTags) return false;
+
+	return true;
+}
+
+void FMounteaInteractableStateItem::PreReplicatedRemove(const FMounteaInteractableStateList& InArraySerializer) const
+{
+	// Removed entry means Interactable is back in its loaded state
+	if (Interactable)
+	{
+		Interactable->ApplyStateSnapshot(FMounteaInteractableStateSnapshot());
+	}
+}
+
+void FMounteaInteractableStateItem::PostReplicatedAdd(const FMounteaInteractableStateList& InArraySerializer) const
+{
+	// Unmapped Interactables are applied once resolved, through PostReplicatedChange
+	if (Interactable)
+	{
+		Interactable->ApplyStateSnapshot(Snapshot);
+	}
+}
+
+void FMounteaInteractableStateItem::PostReplicatedChange(const FMounteaInteractableStateList& InArraySerializer) const
+{
+	if (Interactable)
+	{
+		Interactable->ApplyStateSnapshot(Snapshot);
+	}
+}
+
+bool FMounteaInteractableStateList::SetSnapshot(UMounteaInteractableComponentBase* Interactable, const FMounteaInteractableStateSnapshot& Snapshot)
+{
+	if (!Interactable) return false;
+
+	if (Snapshot.IsDefault())
+	{
+		return Remove(Interactable);
+	}
+
+	if (const int32* Index = Indices.Find(Interactable))
+	{
+		FMounteaInteractableStateItem& Item = Items[*Index];
+		if (Item.Snapshot == Snapshot) return false;
+
+		Item.Snapshot = Snapshot;
+		MarkItemDirty(Item);
+		return true;
+	}
+
+	Indices.Add(Interactable, Items.Num());
+	MarkItemDirty(Items.Emplace_GetRef(Interactable, Snapshot));
+	return true;
+}
+
+bool FMounteaInteractableStateList::Remove(const UMounteaInteractableComponentBase* Interactable)
+{
+	int32 Index = INDEX_NONE;
+	if (!Interactable || !Indices.RemoveAndCopyValue(Interactable, Index)) return false;
+
+	// Fast Array does not depend on order, so the last item is swapped into the gap
+	Items.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (Items.IsValidIndex(Index))
+	{
+		Indices.Add(Items[Index].Interactable.Get(), Index);
+	}
+
+	MarkArrayDirty();
+	return true;
+}
@@ -0,0 +1,79 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaInteractionFilterKey.h"
+
+namespace MounteaFilterKey
+{
+	TMap<FGameplayTag, int32>& GetTagBits()
+	{
+		static TMap<FGameplayTag, int32> TagBits;
+		return TagBits;
+	}
+}
+
+FMounteaInteractionFilterKey FMounteaInteractionFilterKey::MakeInteractable(const ECollisionChannel CollisionChannel, const FGameplayTagContainer& CompatibleTags)
+{
+	FMounteaInteractionFilterKey Key;
+	Key.bRequiresFullMatch = !Key.AddChannel(CollisionChannel);
+	Key.SetBit(AnyTagBit);
+
+	// Interactor Tag matches its own Tag and all of its children, so parents of each Compatible Tag are provided as well
+	for (const FGameplayTag& Tag : CompatibleTags.GetGameplayTagParents())
+	{
+		Key.bRequiresFullMatch |= !Key.AddTag(Tag);
+	}
+
+	return Key;
+}
+
+FMounteaInteractionFilterKey FMounteaInteractionFilterKey::MakeInteractor(const ECollisionChannel ResponseChannel, const FGameplayTag& InteractorTag)
+{
+	FMounteaInteractionFilterKey Key;
+	Key.bRequiresFullMatch = !Key.AddChannel(ResponseChannel);
+
+	if (InteractorTag.IsValid())
+	{
+		Key.bRequiresFullMatch |= !Key.AddTag(InteractorTag);
+	}
+	else
+	{
+		Key.SetBit(AnyTagBit);
+	}
+
+	return Key;
+}
+
+int32 FMounteaInteractionFilterKey::GetAssignedTagsCount()
+{
+	return MounteaFilterKey::GetTagBits().Num();
+}
+
+bool FMounteaInteractionFilterKey::AddChannel(const ECollisionChannel Channel)
+{
+	const int32 Bit = static_cast<int32>(Channel);
+	if (Bit < 0 || Bit >= NumChannelBits) return false;
+
+	SetBit(Bit);
+	return true;
+}
+
+bool FMounteaInteractionFilterKey::AddTag(const FGameplayTag& Tag)
+{
+	check(IsInGameThread());
+
+	if (!Tag.IsValid()) return true;
+
+	TMap<FGameplayTag, int32>& TagBits = MounteaFilterKey::GetTagBits();
+	if (const int32* ExistingBit = TagBits.Find(Tag))
+	{
+		SetBit(*ExistingBit);
+		return true;
+	}
+
+	const int32 NewBit = FirstTagBit + TagBits.Num();
+	if (NewBit >= NumBits) return false;
+
+	TagBits.Add(Tag, NewBit);
+	SetBit(NewBit);
+	return true;
+}
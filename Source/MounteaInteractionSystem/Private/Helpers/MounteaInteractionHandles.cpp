@@ -0,0 +1,87 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaInteractionHandles.h"
+
+#include "UObject/CoreNet.h"
+
+#include "Components/Interactable/MounteaInteractableComponentBase.h"
+#include "Components/Interactor/MounteaInteractorComponentBase.h"
+#include "Subsystems/MounteaInteractionRegistrySubsystem.h"
+
+FMounteaInteractableHandle FMounteaInteractableHandle::Get(const UObject* Interactable)
+{
+	// Base Components cache their own Handle, so no lookup is needed
+	if (const UMounteaInteractableComponentBase* InteractableComponent = Cast<UMounteaInteractableComponentBase>(Interactable))
+	{
+		return InteractableComponent->GetInteractableHandle();
+	}
+	return UMounteaInteractionRegistrySubsystem::AcquireInteractableHandle(Interactable);
+}
+
+FMounteaInteractableHandle FMounteaInteractableHandle::Get(const TScriptInterface<IMounteaInteractableInterface>& Interactable)
+{
+	return Get(Interactable.GetObject());
+}
+
+UObject* FMounteaInteractableHandle::GetObject() const
+{
+	return UMounteaInteractionRegistrySubsystem::ResolveInteractableHandle(*this);
+}
+
+TScriptInterface<IMounteaInteractableInterface> FMounteaInteractableHandle::GetInterface() const
+{
+	return TScriptInterface<IMounteaInteractableInterface>(GetObject());
+}
+
+bool FMounteaInteractableHandle::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// Slot indices are local to each process, so the Object is sent and its Handle is looked up on receive
+	UObject* Object = Ar.IsSaving() ? GetObject() : nullptr;
+	bOutSuccess = Map->SerializeObject(Ar, UObject::StaticClass(), Object);
+
+	if (Ar.IsLoading())
+	{
+		*this = Get(Object);
+	}
+
+	return true;
+}
+
+FMounteaInteractorHandle FMounteaInteractorHandle::Get(const UObject* Interactor)
+{
+	// Base Components cache their own Handle, so no lookup is needed
+	if (const UMounteaInteractorComponentBase* InteractorComponent = Cast<UMounteaInteractorComponentBase>(Interactor))
+	{
+		return InteractorComponent->GetInteractorHandle();
+	}
+	return UMounteaInteractionRegistrySubsystem::AcquireInteractorHandle(Interactor);
+}
+
+FMounteaInteractorHandle FMounteaInteractorHandle::Get(const TScriptInterface<IMounteaInteractorInterface>& Interactor)
+{
+	return Get(Interactor.GetObject());
+}
+
+UObject* FMounteaInteractorHandle::GetObject() const
+{
+	return UMounteaInteractionRegistrySubsystem::ResolveInteractorHandle(*this);
+}
+
+TScriptInterface<IMounteaInteractorInterface> FMounteaInteractorHandle::GetInterface() const
+{
+	return TScriptInterface<IMounteaInteractorInterface>(GetObject());
+}
+
+bool FMounteaInteractorHandle::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// Slot indices are local to each process, so the Object is sent and its Handle is looked up on receive
+	UObject* Object = Ar.IsSaving() ? GetObject() : nullptr;
+	bOutSuccess = Map->SerializeObject(Ar, UObject::StaticClass(), Object);
+
+	if (Ar.IsLoading())
+	{
+		*this = Get(Object);
+	}
+
+	return true;
+}
@@ -0,0 +1,326 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaInteractionNativeDispatch.h"
+
+#include "HAL/IConsoleManager.h"
+#include "UObject/ObjectKey.h"
+
+#include "Components/Interactable/MounteaInteractableComponentBase.h"
+#include "Components/Interactor/MounteaInteractorComponentBase.h"
+#include "Helpers/MounteaInteractionSystemLog.h"
+#include "Interfaces/MounteaInteractableInterface.h"
+#include "Interfaces/MounteaInteractorInterface.h"
+#include "Subsystems/MounteaInteractionRegistrySubsystem.h"
+
+namespace MounteaNativeDispatch
+{
+	/**
+	 * Returns bitmask of Functions which are implemented natively by Class.
+	 * Function is overridden in Blueprint if the UFunction found on Class is owned by non-native Class.
+	 */
+	template<int32 NumFunctions>
+	uint32 ResolveNativeFunctions(const UClass* Class, const FName (&FunctionNames)[NumFunctions], TMap<TObjectKey<UClass>, uint32>& Cache)
+	{
+		check(IsInGameThread());
+		
+		if (!Class) return 0;
+
+		if (const uint32* CachedFunctions = Cache.Find(Class))
+		{
+			return *CachedFunctions;
+		}
+
+		uint32 NativeFunctions = 0;
+		for (int32 Index = 0; Index < NumFunctions; Index++)
+		{
+			const UFunction* Function = Class->FindFunctionByName(FunctionNames[Index]);
+			if (!Function || Function->GetOwnerClass()->HasAnyClassFlags(CLASS_Native))
+			{
+				NativeFunctions |= 1u << Index;
+			}
+		}
+
+		Cache.Add(Class, NativeFunctions);
+		return NativeFunctions;
+	}
+
+	const UMounteaInteractableComponentBase* FindNativeInteractable(const UObject* Interactable, const EMounteaInteractableNativeFunction Function)
+	{
+		const UMounteaInteractableComponentBase* InteractableComponent = Cast<UMounteaInteractableComponentBase>(Interactable);
+		return InteractableComponent && InteractableComponent->CanDispatchNatively(Function) ? InteractableComponent : nullptr;
+	}
+
+	const UMounteaInteractorComponentBase* FindNativeInteractor(const UObject* Interactor, const EMounteaInteractorNativeFunction Function)
+	{
+		const UMounteaInteractorComponentBase* InteractorComponent = Cast<UMounteaInteractorComponentBase>(Interactor);
+		return InteractorComponent && InteractorComponent->CanDispatchNatively(Function) ? InteractorComponent : nullptr;
+	}
+}
+
+#pragma region Interactable
+
+uint32 FMounteaInteractableDispatch::GetNativeFunctions(const UClass* Class)
+{
+	// Order must match EMounteaInteractableNativeFunction
+	static const FName FunctionNames[] =
+	{
+		GET_FUNCTION_NAME_CHECKED(IMounteaInteractableInterface, GetState),
+		GET_FUNCTION_NAME_CHECKED(IMounteaInteractableInterface, CanBeTriggered),
+		GET_FUNCTION_NAME_CHECKED(IMounteaInteractableInterface, GetInteractor),
+		GET_FUNCTION_NAME_CHECKED(IMounteaInteractableInterface, GetInteractableWeight),
+		GET_FUNCTION_NAME_CHECKED(IMounteaInteractableInterface, GetCollisionChannel),
+		GET_FUNCTION_NAME_CHECKED(IMounteaInteractableInterface, GetCollisionComponents),
+		GET_FUNCTION_NAME_CHECKED(IMounteaInteractableInterface, GetInteractableName),
+		GET_FUNCTION_NAME_CHECKED(IMounteaInteractableInterface, GetInteractableCompatibleTags),
+		GET_FUNCTION_NAME_CHECKED(IMounteaInteractableInterface, GetIgnoredClasses)
+	};
+	static_assert(UE_ARRAY_COUNT(FunctionNames) == static_cast<int32>(EMounteaInteractableNativeFunction::MAX), "Function Names do not match EMounteaInteractableNativeFunction");
+
+	static TMap<TObjectKey<UClass>, uint32> Cache;
+	return MounteaNativeDispatch::ResolveNativeFunctions(Class, FunctionNames, Cache);
+}
+
+EInteractableStateV2 FMounteaInteractableDispatch::GetState(const UObject* Interactable)
+{
+	if (const UMounteaInteractableComponentBase* InteractableComponent = MounteaNativeDispatch::FindNativeInteractable(Interactable, EMounteaInteractableNativeFunction::GetState))
+	{
+		return InteractableComponent->GetState_Implementation();
+	}
+	return IMounteaInteractableInterface::Execute_GetState(Interactable);
+}
+
+bool FMounteaInteractableDispatch::CanBeTriggered(const UObject* Interactable)
+{
+	if (const UMounteaInteractableComponentBase* InteractableComponent = MounteaNativeDispatch::FindNativeInteractable(Interactable, EMounteaInteractableNativeFunction::CanBeTriggered))
+	{
+		return InteractableComponent->CanBeTriggered_Implementation();
+	}
+	return IMounteaInteractableInterface::Execute_CanBeTriggered(Interactable);
+}
+
+TScriptInterface<IMounteaInteractorInterface> FMounteaInteractableDispatch::GetInteractor(const UObject* Interactable)
+{
+	if (const UMounteaInteractableComponentBase* InteractableComponent = MounteaNativeDispatch::FindNativeInteractable(Interactable, EMounteaInteractableNativeFunction::GetInteractor))
+	{
+		return InteractableComponent->GetInteractor_Implementation();
+	}
+	return IMounteaInteractableInterface::Execute_GetInteractor(Interactable);
+}
+
+int32 FMounteaInteractableDispatch::GetInteractableWeight(const UObject* Interactable)
+{
+	if (const UMounteaInteractableComponentBase* InteractableComponent = MounteaNativeDispatch::FindNativeInteractable(Interactable, EMounteaInteractableNativeFunction::GetInteractableWeight))
+	{
+		return InteractableComponent->GetInteractableWeight_Implementation();
+	}
+	return IMounteaInteractableInterface::Execute_GetInteractableWeight(Interactable);
+}
+
+ECollisionChannel FMounteaInteractableDispatch::GetCollisionChannel(const UObject* Interactable)
+{
+	if (const UMounteaInteractableComponentBase* InteractableComponent = MounteaNativeDispatch::FindNativeInteractable(Interactable, EMounteaInteractableNativeFunction::GetCollisionChannel))
+	{
+		return InteractableComponent->GetCollisionChannel_Implementation();
+	}
+	return IMounteaInteractableInterface::Execute_GetCollisionChannel(Interactable);
+}
+
+TArray<UPrimitiveComponent*> FMounteaInteractableDispatch::GetCollisionComponents(const UObject* Interactable)
+{
+	if (const UMounteaInteractableComponentBase* InteractableComponent = MounteaNativeDispatch::FindNativeInteractable(Interactable, EMounteaInteractableNativeFunction::GetCollisionComponents))
+	{
+		return InteractableComponent->GetCollisionComponents_Implementation();
+	}
+	return IMounteaInteractableInterface::Execute_GetCollisionComponents(Interactable);
+}
+
+FText FMounteaInteractableDispatch::GetInteractableName(const UObject* Interactable)
+{
+	if (const UMounteaInteractableComponentBase* InteractableComponent = MounteaNativeDispatch::FindNativeInteractable(Interactable, EMounteaInteractableNativeFunction::GetInteractableName))
+	{
+		return InteractableComponent->GetInteractableName_Implementation();
+	}
+	return IMounteaInteractableInterface::Execute_GetInteractableName(Interactable);
+}
+
+FGameplayTagContainer FMounteaInteractableDispatch::GetInteractableCompatibleTags(const UObject* Interactable)
+{
+	if (const UMounteaInteractableComponentBase* InteractableComponent = MounteaNativeDispatch::FindNativeInteractable(Interactable, EMounteaInteractableNativeFunction::GetInteractableCompatibleTags))
+	{
+		return InteractableComponent->GetInteractableCompatibleTags_Implementation();
+	}
+	return IMounteaInteractableInterface::Execute_GetInteractableCompatibleTags(Interactable);
+}
+
+bool FMounteaInteractableDispatch::IsCompatible(const UObject* Interactable, const FMounteaInteractionFilterKey& InteractorKey, const ECollisionChannel ResponseChannel, const FGameplayTag& InteractorTag)
+{
+	const UMounteaInteractableComponentBase* InteractableComponent = Cast<UMounteaInteractableComponentBase>(Interactable);
+	if (InteractableComponent && !InteractorKey.bRequiresFullMatch
+		&& InteractableComponent->CanDispatchNatively(EMounteaInteractableNativeFunction::GetCollisionChannel)
+		&& InteractableComponent->CanDispatchNatively(EMounteaInteractableNativeFunction::GetInteractableCompatibleTags))
+	{
+		const FMounteaInteractionFilterKey& InteractableKey = InteractableComponent->GetFilterKey();
+		if (!InteractableKey.bRequiresFullMatch)
+		{
+			return FMounteaInteractionFilterKey::Matches(InteractableKey, InteractorKey);
+		}
+	}
+
+	if (GetCollisionChannel(Interactable) != ResponseChannel) return false;
+	
+	return !InteractorTag.IsValid() || GetInteractableCompatibleTags(Interactable).HasTag(InteractorTag);
+}
+
+bool FMounteaInteractableDispatch::IsInteractorIgnored(const UObject* Interactable, const UObject* Interactor)
+{
+	if (!Interactor) return false;
+
+	if (const UMounteaInteractableComponentBase* InteractableComponent = MounteaNativeDispatch::FindNativeInteractable(Interactable, EMounteaInteractableNativeFunction::GetIgnoredClasses))
+	{
+		return InteractableComponent->IsInteractorClassIgnored(Interactor->GetClass());
+	}
+
+	for (const TSoftClassPtr<UObject>& Itr : IMounteaInteractableInterface::Execute_GetIgnoredClasses(Interactable))
+	{
+		const UClass* IgnoredClass = Itr.Get();
+		if (IgnoredClass && Interactor->IsA(IgnoredClass)) return true;
+	}
+
+	return false;
+}
+
+#pragma endregion
+
+#pragma region Interactor
+
+uint32 FMounteaInteractorDispatch::GetNativeFunctions(const UClass* Class)
+{
+	// Order must match EMounteaInteractorNativeFunction
+	static const FName FunctionNames[] =
+	{
+		GET_FUNCTION_NAME_CHECKED(IMounteaInteractorInterface, GetState),
+		GET_FUNCTION_NAME_CHECKED(IMounteaInteractorInterface, IsValidInteractor),
+		GET_FUNCTION_NAME_CHECKED(IMounteaInteractorInterface, CanInteract),
+		GET_FUNCTION_NAME_CHECKED(IMounteaInteractorInterface, GetResponseChannel),
+		GET_FUNCTION_NAME_CHECKED(IMounteaInteractorInterface, GetInteractorTag),
+		GET_FUNCTION_NAME_CHECKED(IMounteaInteractorInterface, GetActiveInteractable)
+	};
+	static_assert(UE_ARRAY_COUNT(FunctionNames) == static_cast<int32>(EMounteaInteractorNativeFunction::MAX), "Function Names do not match EMounteaInteractorNativeFunction");
+
+	static TMap<TObjectKey<UClass>, uint32> Cache;
+	return MounteaNativeDispatch::ResolveNativeFunctions(Class, FunctionNames, Cache);
+}
+
+EInteractorStateV2 FMounteaInteractorDispatch::GetState(const UObject* Interactor)
+{
+	if (const UMounteaInteractorComponentBase* InteractorComponent = MounteaNativeDispatch::FindNativeInteractor(Interactor, EMounteaInteractorNativeFunction::GetState))
+	{
+		return InteractorComponent->GetState_Implementation();
+	}
+	return IMounteaInteractorInterface::Execute_GetState(Interactor);
+}
+
+bool FMounteaInteractorDispatch::IsValidInteractor(const UObject* Interactor)
+{
+	if (const UMounteaInteractorComponentBase* InteractorComponent = MounteaNativeDispatch::FindNativeInteractor(Interactor, EMounteaInteractorNativeFunction::IsValidInteractor))
+	{
+		return InteractorComponent->IsValidInteractor_Implementation();
+	}
+	return IMounteaInteractorInterface::Execute_IsValidInteractor(Interactor);
+}
+
+bool FMounteaInteractorDispatch::CanInteract(const UObject* Interactor)
+{
+	if (const UMounteaInteractorComponentBase* InteractorComponent = MounteaNativeDispatch::FindNativeInteractor(Interactor, EMounteaInteractorNativeFunction::CanInteract))
+	{
+		return InteractorComponent->CanInteract_Implementation();
+	}
+	return IMounteaInteractorInterface::Execute_CanInteract(Interactor);
+}
+
+ECollisionChannel FMounteaInteractorDispatch::GetResponseChannel(const UObject* Interactor)
+{
+	if (const UMounteaInteractorComponentBase* InteractorComponent = MounteaNativeDispatch::FindNativeInteractor(Interactor, EMounteaInteractorNativeFunction::GetResponseChannel))
+	{
+		return InteractorComponent->GetResponseChannel_Implementation();
+	}
+	return IMounteaInteractorInterface::Execute_GetResponseChannel(Interactor);
+}
+
+FGameplayTag FMounteaInteractorDispatch::GetInteractorTag(const UObject* Interactor)
+{
+	if (const UMounteaInteractorComponentBase* InteractorComponent = MounteaNativeDispatch::FindNativeInteractor(Interactor, EMounteaInteractorNativeFunction::GetInteractorTag))
+	{
+		return InteractorComponent->GetInteractorTag_Implementation();
+	}
+	return IMounteaInteractorInterface::Execute_GetInteractorTag(Interactor);
+}
+
+TScriptInterface<IMounteaInteractableInterface> FMounteaInteractorDispatch::GetActiveInteractable(const UObject* Interactor)
+{
+	if (const UMounteaInteractorComponentBase* InteractorComponent = MounteaNativeDispatch::FindNativeInteractor(Interactor, EMounteaInteractorNativeFunction::GetActiveInteractable))
+	{
+		return InteractorComponent->GetActiveInteractable_Implementation();
+	}
+	return IMounteaInteractorInterface::Execute_GetActiveInteractable(Interactor);
+}
+
+#pragma endregion
+
+#pragma region Benchmark
+
+#if !UE_BUILD_SHIPPING
+
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkNativeDispatchCommand
+(
+	TEXT("Mountea.Interaction.BenchmarkNativeDispatch"),
+	TEXT("Measures per call cost of Execute_ thunk and native dispatch on registered Interactables. Usage: Mountea.Interaction.BenchmarkNativeDispatch [Iterations]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		const UMounteaInteractionRegistrySubsystem* Registry = UMounteaInteractionRegistrySubsystem::Get(World);
+		if (!Registry || Registry->GetInteractablesCount() == 0)
+		{
+			UE_LOG(LogActorInteraction, Warning, TEXT("[BenchmarkNativeDispatch] No registered Interactables!"))
+			return;
+		}
+
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+
+		int64 Checksum = 0;
+		int64 Calls = 0;
+		double ExecuteSeconds = 0.0;
+		double NativeSeconds = 0.0;
+
+		for (const auto& Itr : Registry->GetInteractables())
+		{
+			const UMounteaInteractableComponentBase* Interactable = Itr.Get();
+			if (!Interactable) continue;
+
+			double StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < Iterations; Index++)
+			{
+				Checksum += IMounteaInteractableInterface::Execute_GetInteractableWeight(Interactable);
+			}
+			ExecuteSeconds += FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < Iterations; Index++)
+			{
+				Checksum += FMounteaInteractableDispatch::GetInteractableWeight(Interactable);
+			}
+			NativeSeconds += FPlatformTime::Seconds() - StartTime;
+
+			Calls += Iterations;
+		}
+
+		const double ExecuteNanoseconds = ExecuteSeconds * 1e9 / FMath::Max<int64>(1, Calls);
+		const double NativeNanoseconds = NativeSeconds * 1e9 / FMath::Max<int64>(1, Calls);
+
+		UE_LOG(LogActorInteraction, Display, TEXT("[BenchmarkNativeDispatch] GetInteractableWeight, %lld calls: Execute_ %.1f ns/call, Native %.1f ns/call, saved %.1f ns/call (checksum %lld)"),
+			Calls, ExecuteNanoseconds, NativeNanoseconds, ExecuteNanoseconds - NativeNanoseconds, Checksum)
+	})
+);
+
+#endif
+
+#pragma endregion
@@ -0,0 +1,193 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaInteractionStateMachine.h"
+
+#include "HAL/IConsoleManager.h"
+
+#include "Helpers/MounteaInteractionSystemLog.h"
+
+namespace MounteaInteractionStateMachine
+{
+	static const TCHAR* CurrentCause = nullptr;
+
+	#pragma region Validation
+
+	// Transition tables are verified exhaustively, for each pair of States, when the module compiles
+
+	template<typename TableType, typename PredicateType>
+	constexpr bool AllTransitions(const TableType& Table, PredicateType Predicate)
+	{
+		for (int32 From = 0; From < TableType::NumStates; From++)
+		{
+			for (int32 To = 0; To < TableType::NumStates; To++)
+			{
+				if (!Predicate(From, To, Table.Actions[From][To]))
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	template<typename TableType>
+	constexpr int32 CountValidTransitions(const TableType& Table)
+	{
+		int32 Count = 0;
+		for (int32 From = 0; From < TableType::NumStates; From++)
+		{
+			for (int32 To = 0; To < TableType::NumStates; To++)
+			{
+				Count += Table.IsValid(static_cast<typename TableType::FStateType>(From), static_cast<typename TableType::FStateType>(To)) ? 1 : 0;
+			}
+		}
+		return Count;
+	}
+
+	constexpr bool IsInteractableIndex(const int32 Index, const EInteractableStateV2 State)
+	{ return Index == static_cast<int32>(State); };
+
+	constexpr bool IsInteractorIndex(const int32 Index, const EInteractorStateV2 State)
+	{ return Index == static_cast<int32>(State); };
+
+	using EInteractableActions = EMounteaInteractableTransitionActions;
+	using EInteractorActions = EMounteaInteractorTransitionActions;
+
+	static_assert(AllTransitions(InteractableTransitions, [](const int32 From, const int32 To, const EInteractableActions Actions)
+	{
+		return From != To || !EnumHasAnyFlags(Actions, EInteractableActions::ChangeState);
+	}), "Interactable State cannot transition to itself.");
+
+	static_assert(AllTransitions(InteractableTransitions, [](const int32 From, const int32 To, const EInteractableActions Actions)
+	{
+		return !(IsInteractableIndex(From, EInteractableStateV2::Default) || IsInteractableIndex(To, EInteractableStateV2::Default)) || !EnumHasAnyFlags(Actions, EInteractableActions::ChangeState);
+	}), "Default is not a real Interactable State.");
+
+	static_assert(AllTransitions(InteractableTransitions, [](const int32 From, const int32 To, const EInteractableActions Actions)
+	{
+		return EnumHasAnyFlags(Actions, EInteractableActions::ChangeState) || Actions == EInteractableActions::None || (IsInteractableIndex(To, EInteractableStateV2::Default) && Actions == EInteractableActions::StopHighlight);
+	}), "Invalid Interactable transitions cannot have side effects.");
+
+	static_assert(AllTransitions(InteractableTransitions, [](const int32 From, const int32 To, const EInteractableActions Actions)
+	{
+		return !EnumHasAnyFlags(Actions, EInteractableActions::ChangeState) || EnumHasAnyFlags(Actions, EInteractableActions::BroadcastStateChanged | EInteractableActions::Cleanup);
+	}), "Valid Interactable transitions must broadcast State change.");
+
+	static_assert(AllTransitions(InteractableTransitions, [](const int32 From, const int32 To, const EInteractableActions Actions)
+	{
+		const bool bCanHighlight = IsInteractableIndex(To, EInteractableStateV2::EIS_Active) || IsInteractableIndex(To, EInteractableStateV2::EIS_Awake) || IsInteractableIndex(To, EInteractableStateV2::EIS_Paused);
+		return bCanHighlight || !EnumHasAnyFlags(Actions, EInteractableActions::ChangeState) || EnumHasAnyFlags(Actions, EInteractableActions::StopHighlight | EInteractableActions::Cleanup);
+	}), "Transitions to States without interaction must stop highlight.");
+
+	static_assert(AllTransitions(InteractableTransitions, [](const int32 From, const int32 To, const EInteractableActions Actions)
+	{
+		return !EnumHasAllFlags(Actions, EInteractableActions::BindCollision | EInteractableActions::UnbindCollision) && (!EnumHasAnyFlags(Actions, EInteractableActions::BindCollision) || IsInteractableIndex(To, EInteractableStateV2::EIS_Awake));
+	}), "Only transitions to Awake bind Collision Components.");
+
+	static_assert(AllTransitions(InteractableTransitions, [](const int32 From, const int32 To, const EInteractableActions Actions)
+	{
+		const bool bEntersCompleted = IsInteractableIndex(To, EInteractableStateV2::EIS_Completed);
+		const bool bLeavesCompleted = IsInteractableIndex(From, EInteractableStateV2::EIS_Completed);
+		return !EnumHasAnyFlags(Actions, EInteractableActions::ChangeState)
+			|| ((!bEntersCompleted || IsInteractableIndex(From, EInteractableStateV2::EIS_Active)) && (!bLeavesCompleted || IsInteractableIndex(To, EInteractableStateV2::EIS_Disabled)));
+	}), "Completed is entered from Active only and left to Disabled only.");
+
+	static_assert(CountValidTransitions(InteractableTransitions) == 33, "Interactable transition table has changed, review validation above.");
+
+	static_assert(AllTransitions(InteractorTransitions, [](const int32 From, const int32 To, const EInteractorActions Actions)
+	{
+		return From != To || !EnumHasAnyFlags(Actions, EInteractorActions::ChangeState);
+	}), "Interactor State cannot transition to itself.");
+
+	static_assert(AllTransitions(InteractorTransitions, [](const int32 From, const int32 To, const EInteractorActions Actions)
+	{
+		const bool bValid = EnumHasAnyFlags(Actions, EInteractorActions::ChangeState);
+		return bValid ? EnumHasAnyFlags(Actions, EInteractorActions::ProcessStateChanged) : Actions == EInteractorActions::None;
+	}), "Interactor transitions must process State change if and only if valid.");
+
+	static_assert(AllTransitions(InteractorTransitions, [](const int32 From, const int32 To, const EInteractorActions Actions)
+	{
+		return !EnumHasAnyFlags(Actions, EInteractorActions::ChangeState) || !(IsInteractorIndex(From, EInteractorStateV2::Default) || IsInteractorIndex(To, EInteractorStateV2::Default));
+	}), "Default is not a real Interactor State.");
+
+	static_assert(AllTransitions(InteractorTransitions, [](const int32 From, const int32 To, const EInteractorActions Actions)
+	{
+		return !EnumHasAnyFlags(Actions, EInteractorActions::ChangeState) || !IsInteractorIndex(To, EInteractorStateV2::EIS_Active) || IsInteractorIndex(From, EInteractorStateV2::EIS_Awake);
+	}), "Interactor can become Active only when Awake.");
+
+	static_assert(CountValidTransitions(InteractorTransitions) == 16, "Interactor transition table has changed, review validation above.");
+
+	static_assert(InteractableTransitions.Get(EInteractableStateV2::EIS_Cooldown, EInteractableStateV2::EIS_Suppressed) == (EInteractableActions::CancelInteraction | EInteractableActions::ChangeState | EInteractableActions::StopHighlight | EInteractableActions::BroadcastStateChanged | EInteractableActions::ClearCooldown), "Suppressing Interactable in Cooldown clears Cooldown timer.");
+	static_assert(InteractableTransitions.Get(EInteractableStateV2::EIS_Active, static_cast<EInteractableStateV2>(0xFF)) == EInteractableActions::StopHighlight, "Out of range States resolve to Default.");
+
+	#pragma endregion
+
+	FOnInteractableTransitionNative& OnInteractableTransition()
+	{
+		static FOnInteractableTransitionNative Delegate;
+		return Delegate;
+	}
+
+	FOnInteractorTransitionNative& OnInteractorTransition()
+	{
+		static FOnInteractorTransitionNative Delegate;
+		return Delegate;
+	}
+
+	const TCHAR* GetTransitionCause()
+	{ return CurrentCause; }
+
+	FScopedTransitionCause::FScopedTransitionCause(const TCHAR* InCause)
+		: PreviousCause(CurrentCause)
+	{
+		check(IsInGameThread());
+		CurrentCause = InCause;
+	}
+
+	FScopedTransitionCause::~FScopedTransitionCause()
+	{
+		CurrentCause = PreviousCause;
+	}
+}
+
+#pragma region Trace
+
+#if !UE_BUILD_SHIPPING
+
+static FAutoConsoleCommandWithArgs TraceStateTransitionsCommand
+(
+	TEXT("Mountea.Interaction.TraceStateTransitions"),
+	TEXT("Logs each requested Interactable and Interactor State transition with its cause. Usage: Mountea.Interaction.TraceStateTransitions [0/1]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		static FDelegateHandle InteractableHandle;
+		static FDelegateHandle InteractorHandle;
+
+		const bool bEnable = Args.Num() > 0 ? FCString::Atoi(*Args[0]) != 0 : !InteractableHandle.IsValid();
+
+		MounteaInteractionStateMachine::OnInteractableTransition().Remove(InteractableHandle);
+		MounteaInteractionStateMachine::OnInteractorTransition().Remove(InteractorHandle);
+		InteractableHandle.Reset();
+		InteractorHandle.Reset();
+
+		if (bEnable)
+		{
+			InteractableHandle = MounteaInteractionStateMachine::OnInteractableTransition().AddLambda([](const UObject* Interactable, const EInteractableStateV2 From, const EInteractableStateV2 To, const EMounteaInteractableTransitionActions Actions, const TCHAR* Cause)
+			{
+				UE_LOG(LogActorInteraction, Display, TEXT("[TraceStateTransitions] %s: %s -> %s, actions 0x%03x, cause %s"),
+					*GetNameSafe(Interactable), *UEnum::GetValueAsString(From), *UEnum::GetValueAsString(To), static_cast<uint32>(Actions), Cause ? Cause : TEXT("None"))
+			});
+			InteractorHandle = MounteaInteractionStateMachine::OnInteractorTransition().AddLambda([](const UObject* Interactor, const EInteractorStateV2 From, const EInteractorStateV2 To, const EMounteaInteractorTransitionActions Actions, const TCHAR* Cause)
+			{
+				UE_LOG(LogActorInteraction, Display, TEXT("[TraceStateTransitions] %s: %s -> %s, actions 0x%03x, cause %s"),
+					*GetNameSafe(Interactor), *UEnum::GetValueAsString(From), *UEnum::GetValueAsString(To), static_cast<uint32>(Actions), Cause ? Cause : TEXT("None"))
+			});
+		}
+
+		UE_LOG(LogActorInteraction, Display, TEXT("[TraceStateTransitions] %s"), bEnable ? TEXT("Enabled") : TEXT("Disabled"))
+	})
+);
+
+#endif
+
+#pragma endregion
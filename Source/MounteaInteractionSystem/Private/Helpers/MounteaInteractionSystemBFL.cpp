@@ -18,79 +18,216 @@
 #include "Internationalization/Regex.h"
 
 #include "Components/MeshComponent.h"
+#include "UObject/ObjectKey.h"
 
 #include "Engine/World.h"
 
-UMeshComponent* UMounteaInteractionSystemBFL::FindMeshByTag(const FName Tag, const AActor* Source)
+namespace MounteaComponentLookup
 {
-	if (!Source) return nullptr;
+	/**
+	 * Components of an Actor indexed by their names and tags.
+	 * Rebuilt once number of Actor's Components changes or any indexed Component is destroyed.
+	 * Tags may change at runtime, so tag hits are verified and tag misses are confirmed by scanning the Actor.
+	 */
+	struct FActorComponents
+	{
+		int32																	NumComponents = 0;
+		TMap<FName, TWeakObjectPtr<UActorComponent>>				ByName;
+		/** Components of each tag, in the same order as Actor returns them. */
+		TMap<FName, TArray<TWeakObjectPtr<UActorComponent>>>		ByTag;
+
+		void Build(const AActor* Source)
+		{
+			NumComponents = Source->GetComponents().Num();
+			ByName.Reset();
+			ByTag.Reset();
+
+			for (UActorComponent* Itr : Source->GetComponents())
+			{
+				if (!IsValid(Itr)) continue;
 
-	TArray<UMeshComponent*> MeshComponents;
-	Source->GetComponents(MeshComponents);
+				if (!ByName.Contains(Itr->GetFName()))
+				{
+					ByName.Add(Itr->GetFName(), Itr);
+				}
 
-	for (const auto& Itr : MeshComponents)
+				for (const FName& Tag : Itr->ComponentTags)
+				{
+					ByTag.FindOrAdd(Tag).Add(Itr);
+				}
+			}
+		}
+	};
+
+	TMap<TObjectKey<AActor>, FActorComponents>& GetCache()
 	{
-		if (Itr && Itr->ComponentHasTag(Tag))
+		static TMap<TObjectKey<AActor>, FActorComponents> Cache;
+		return Cache;
+	}
+
+	/** Returns lookup of Source, building it if needed. Null outside of Game Thread. */
+	FActorComponents* Get(const AActor* Source, bool bForceRebuild = false)
+	{
+		if (!Source || !IsInGameThread()) return nullptr;
+
+		TMap<TObjectKey<AActor>, FActorComponents>& Cache = GetCache();
+		FActorComponents* ActorComponents = Cache.Find(Source);
+		if (!ActorComponents)
+		{
+			// Destroyed Actors are purged whenever the cache doubles
+			static int32 PurgeThreshold = 256;
+			if (Cache.Num() >= PurgeThreshold)
+			{
+				for (auto It = Cache.CreateIterator(); It; ++It)
+				{
+					if (!It.Key().ResolveObjectPtr())
+					{
+						It.RemoveCurrent();
+					}
+				}
+				PurgeThreshold = FMath::Max(256, Cache.Num() * 2);
+			}
+			
+			ActorComponents = &Cache.Add(Source);
+			bForceRebuild = true;
+		}
+
+		if (bForceRebuild || ActorComponents->NumComponents != Source->GetComponents().Num())
 		{
-			return Itr;
+			ActorComponents->Build(Source);
 		}
+
+		return ActorComponents;
 	}
 
-	return nullptr;
-}
+	template<typename ComponentType>
+	ComponentType* FindByName(const FName Name, const AActor* Source)
+	{
+		FActorComponents* ActorComponents = Get(Source);
+		if (!ActorComponents)
+		{
+			if (!Source) return nullptr;
 
-UMeshComponent* UMounteaInteractionSystemBFL::FindMeshByName(const FName Name, const AActor* Source)
-{
-	if (!Source) return nullptr;
+			TArray<ComponentType*> Components;
+			Source->GetComponents(Components);
 
-	TArray<UMeshComponent*> MeshComponents;
-	Source->GetComponents(MeshComponents);
+			ComponentType* const* Found = Components.FindByPredicate([Name](const ComponentType* Itr) { return Itr && Itr->GetFName() == Name; });
+			return Found ? *Found : nullptr;
+		}
 
-	for (const auto& Itr : MeshComponents)
-	{
-		if (Itr && Itr->GetName().Equals(Name.ToString()))
+		// Stale entry means Components have changed without changing their number
+		const TWeakObjectPtr<UActorComponent>* Found = ActorComponents->ByName.Find(Name);
+		if (Found && !Found->IsValid())
 		{
-			return Itr;
+			ActorComponents = Get(Source, true);
+			Found = ActorComponents->ByName.Find(Name);
 		}
+
+		return Found ? Cast<ComponentType>(Found->Get()) : nullptr;
 	}
 
-	return nullptr;
-}
+	template<typename ComponentType>
+	ComponentType* ScanByTag(const FName Tag, const AActor* Source)
+	{
+		if (!Source) return nullptr;
 
-UPrimitiveComponent* UMounteaInteractionSystemBFL::FindPrimitiveByTag(const FName Tag, const AActor* Source)
-{
-	if (!Source) return nullptr;
+		TArray<ComponentType*> Components;
+		Source->GetComponents(Components);
 
-	TArray<UPrimitiveComponent*> MeshComponents;
-	Source->GetComponents(MeshComponents);
+		ComponentType* const* Found = Components.FindByPredicate([Tag](const ComponentType* Itr) { return Itr && Itr->ComponentHasTag(Tag); });
+		return Found ? *Found : nullptr;
+	}
 
-	for (const auto& Itr : MeshComponents)
+	template<typename ComponentType>
+	ComponentType* FindByTag(const FName Tag, const AActor* Source)
 	{
-		if (Itr && Itr->ComponentHasTag(Tag))
+		FActorComponents* ActorComponents = Get(Source);
+		if (!ActorComponents)
 		{
-			return Itr;
+			return ScanByTag<ComponentType>(Tag, Source);
 		}
-	}
 
-	return nullptr;
-}
+		// Entries before the hit are verified too, as any of them may have been the hit before its tag was removed
+		bool bStale = false;
+		if (const TArray<TWeakObjectPtr<UActorComponent>>* Tagged = ActorComponents->ByTag.Find(Tag))
+		{
+			for (const TWeakObjectPtr<UActorComponent>& Itr : *Tagged)
+			{
+				const UActorComponent* Component = Itr.Get();
+				if (!Component || !Component->ComponentHasTag(Tag))
+				{
+					bStale = true;
+					break;
+				}
+
+				if (ComponentType* TypedComponent = Cast<ComponentType>(Itr.Get()))
+				{
+					return TypedComponent;
+				}
+			}
+		}
 
-UPrimitiveComponent* UMounteaInteractionSystemBFL::FindPrimitiveByName(const FName Name, const AActor* Source)
-{
-	if (!Source) return nullptr;
+		// Tag may have been added at runtime, lookup is rebuilt only if it proves outdated
+		ComponentType* Scanned = ScanByTag<ComponentType>(Tag, Source);
+		if (bStale || Scanned)
+		{
+			Get(Source, true);
+		}
 
-	TArray<UPrimitiveComponent*> MeshComponents;
-	Source->GetComponents(MeshComponents);
+		return Scanned;
+	}
 
-	for (const auto& Itr : MeshComponents)
+	template<typename ComponentType>
+	TArray<ComponentType*> FindByNameOrTag(const TArray<FName>& NamesOrTags, const AActor* Source)
 	{
-		if (Itr && Itr->GetName().Equals(Name.ToString()))
+		TArray<ComponentType*> Result;
+		Result.Reserve(NamesOrTags.Num());
+
+		for (const FName& Itr : NamesOrTags)
 		{
-			return Itr;
+			ComponentType* Component = FindByName<ComponentType>(Itr, Source);
+			Result.Add(Component ? Component : FindByTag<ComponentType>(Itr, Source));
 		}
+
+		return Result;
 	}
+}
 
-	return nullptr;
+UMeshComponent* UMounteaInteractionSystemBFL::FindMeshByTag(const FName Tag, const AActor* Source)
+{
+	return MounteaComponentLookup::FindByTag<UMeshComponent>(Tag, Source);
+}
+
+UMeshComponent* UMounteaInteractionSystemBFL::FindMeshByName(const FName Name, const AActor* Source)
+{
+	return MounteaComponentLookup::FindByName<UMeshComponent>(Name, Source);
+}
+
+UPrimitiveComponent* UMounteaInteractionSystemBFL::FindPrimitiveByTag(const FName Tag, const AActor* Source)
+{
+	return MounteaComponentLookup::FindByTag<UPrimitiveComponent>(Tag, Source);
+}
+
+UPrimitiveComponent* UMounteaInteractionSystemBFL::FindPrimitiveByName(const FName Name, const AActor* Source)
+{
+	return MounteaComponentLookup::FindByName<UPrimitiveComponent>(Name, Source);
+}
+
+TArray<UPrimitiveComponent*> UMounteaInteractionSystemBFL::FindPrimitivesByNameOrTag(const TArray<FName>& NamesOrTags, const AActor* Source)
+{
+	return MounteaComponentLookup::FindByNameOrTag<UPrimitiveComponent>(NamesOrTags, Source);
+}
+
+TArray<UMeshComponent*> UMounteaInteractionSystemBFL::FindMeshesByNameOrTag(const TArray<FName>& NamesOrTags, const AActor* Source)
+{
+	return MounteaComponentLookup::FindByNameOrTag<UMeshComponent>(NamesOrTags, Source);
+}
+
+void UMounteaInteractionSystemBFL::InvalidateComponentLookup(const AActor* Source)
+{
+	if (!Source || !IsInGameThread()) return;
+
+	MounteaComponentLookup::GetCache().Remove(Source);
 }
 
 UMounteaInteractionSystemSettings* UMounteaInteractionSystemBFL::GetInteractionSystemSettings()
@@ -9,11 +9,21 @@
 
 UMounteaInteractionSystemSettings::UMounteaInteractionSystemSettings() :
 	bEditorDebugEnabled(true),
+	bEnableInteractableNetDormancy(false),
+	bEnableServerRPCRateLimiting(false),
+	bEnableInteractionStateManager(false),
+	bTimeSliceInteractableRegistration(false),
 	LogVerbosity(14),
 	WidgetUpdateFrequency(0.1f)
 {
 	CategoryName = TEXT("Mountea Framework");
 	SectionName = TEXT("Mountea Interaction System");
+
+	ServerRPCBudgets.Add(EMounteaServerRPCType::ESRT_Interaction,	FMounteaServerRPCBudget(10.f, 10));
+	ServerRPCBudgets.Add(EMounteaServerRPCType::ESRT_Trace,			FMounteaServerRPCBudget(30.f, 30));
+	ServerRPCBudgets.Add(EMounteaServerRPCType::ESRT_Overlap,		FMounteaServerRPCBudget(60.f, 60));
+	ServerRPCBudgets.Add(EMounteaServerRPCType::ESRT_State,			FMounteaServerRPCBudget(10.f, 20));
+	ServerRPCBudgets.Add(EMounteaServerRPCType::ESRT_Config,			FMounteaServerRPCBudget(10.f, 30));
 }
 
 TSoftClassPtr<UUserWidget> UMounteaInteractionSystemSettings::GetInteractableDefaultWidgetClass() const
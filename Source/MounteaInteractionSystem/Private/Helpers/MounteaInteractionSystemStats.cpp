@@ -0,0 +1,7 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaInteractionSystemStats.h"
+
+// Stat definitions
+DEFINE_STAT(STAT_MounteaDormantInteractables);
+DEFINE_STAT(STAT_MounteaDroppedServerRPCs);
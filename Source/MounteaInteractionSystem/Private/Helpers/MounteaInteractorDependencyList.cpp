@@ -0,0 +1,116 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaInteractorDependencyList.h"
+
+#include "Components/Interactor/MounteaInteractorComponentBase.h"
+
+void FMounteaInteractorDependencyItem::PreReplicatedRemove(const FMounteaInteractorDependencyList& InArraySerializer)
+{
+	// Handle of destroyed Dependency does not resolve anymore, announced Object is used instead
+	UObject* AnnouncedObject = DependencyObject.Get();
+	DependencyObject.Reset();
+	
+	if (AnnouncedObject && InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->ProcessDependencyRemoved(TScriptInterface<IMounteaInteractorInterface>(AnnouncedObject));
+	}
+}
+
+void FMounteaInteractorDependencyItem::PostReplicatedAdd(const FMounteaInteractorDependencyList& InArraySerializer)
+{
+	// Dependency not mapped yet arrives as null, it is announced from PostReplicatedChange once resolved
+	UObject* ResolvedObject = Dependency.GetObject();
+	if (!ResolvedObject) return;
+
+	DependencyObject = ResolvedObject;
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->ProcessDependencyAdded(TScriptInterface<IMounteaInteractorInterface>(ResolvedObject));
+	}
+}
+
+void FMounteaInteractorDependencyItem::PostReplicatedChange(const FMounteaInteractorDependencyList& InArraySerializer)
+{
+	UObject* ResolvedObject = Dependency.GetObject();
+	UObject* AnnouncedObject = DependencyObject.Get();
+	if (ResolvedObject == AnnouncedObject) return;
+
+	if (AnnouncedObject)
+	{
+		PreReplicatedRemove(InArraySerializer);
+	}
+	PostReplicatedAdd(InArraySerializer);
+}
+
+bool FMounteaInteractorDependencyItem::IsStale() const
+{
+	const UObject* ResolvedObject = DependencyObject.Get();
+	return !ResolvedObject || Dependency.GetObject() != ResolvedObject;
+}
+
+bool FMounteaInteractorDependencyList::Contains(const TScriptInterface<IMounteaInteractorInterface>& Dependency) const
+{
+	// Stored Objects are compared, so lookups never acquire Handles for unknown Interactors
+	const UObject* DependencyObject = Dependency.GetObject();
+	if (!DependencyObject) return false;
+	
+	return Items.ContainsByPredicate([DependencyObject](const FMounteaInteractorDependencyItem& Itr)
+	{
+		return Itr.DependencyObject.Get() == DependencyObject && !Itr.IsStale();
+	});
+}
+
+bool FMounteaInteractorDependencyList::Add(const TScriptInterface<IMounteaInteractorInterface>& Dependency)
+{
+	RemoveStaleItems();
+	
+	if (Contains(Dependency)) return false;
+	
+	const FMounteaInteractorHandle DependencyHandle = FMounteaInteractorHandle::Get(Dependency);
+	if (!DependencyHandle.IsValid()) return false;
+
+	MarkItemDirty(Items.Emplace_GetRef(DependencyHandle, Dependency.GetObject()));
+	return true;
+}
+
+bool FMounteaInteractorDependencyList::Remove(const TScriptInterface<IMounteaInteractorInterface>& Dependency)
+{
+	RemoveStaleItems();
+	
+	const UObject* DependencyObject = Dependency.GetObject();
+	if (!DependencyObject) return false;
+	
+	const int32 RemovedCount = Items.RemoveAll([DependencyObject](const FMounteaInteractorDependencyItem& Itr)
+	{
+		return Itr.DependencyObject.Get() == DependencyObject;
+	});
+	if (RemovedCount == 0) return false;
+
+	MarkArrayDirty();
+	return true;
+}
+
+bool FMounteaInteractorDependencyList::RemoveStaleItems()
+{
+	const int32 RemovedCount = Items.RemoveAll([](const FMounteaInteractorDependencyItem& Itr)
+	{
+		return Itr.IsStale();
+	});
+	if (RemovedCount == 0) return false;
+
+	MarkArrayDirty();
+	return true;
+}
+
+TArray<TScriptInterface<IMounteaInteractorInterface>> FMounteaInteractorDependencyList::GetDependencies() const
+{
+	TArray<TScriptInterface<IMounteaInteractorInterface>> Result;
+	Result.Reserve(Items.Num());
+	for (const auto& Itr : Items)
+	{
+		if (Itr.IsStale()) continue;
+		
+		Result.Add(TScriptInterface<IMounteaInteractorInterface>(Itr.DependencyObject.Get()));
+	}
+	return Result;
+}
@@ -0,0 +1,89 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Networking/MounteaInteractionStateManager.h"
+
+#include "Components/Interactable/MounteaInteractableComponentBase.h"
+#include "Subsystems/MounteaInteractionRegistrySubsystem.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+AMounteaInteractionStateManager::AMounteaInteractionStateManager()
+{
+	bReplicates = true;
+	bAlwaysRelevant = true;
+
+	// Changes are pushed, so frequent updates do not cost anything while nothing changes
+	SetNetUpdateFrequency(10.f);
+	SetMinNetUpdateFrequency(2.f);
+}
+
+AMounteaInteractionStateManager* AMounteaInteractionStateManager::Get(const UObject* WorldContextObject)
+{
+	const UMounteaInteractionRegistrySubsystem* Registry = UMounteaInteractionRegistrySubsystem::Get(WorldContextObject);
+	return Registry ? Registry->GetInteractionStateManager() : nullptr;
+}
+
+void AMounteaInteractionStateManager::UpdateInteractable(UMounteaInteractableComponentBase* Interactable, const FMounteaInteractableStateSnapshot& Snapshot)
+{
+	if (!HasAuthority()) return;
+
+	if (InteractableStates.SetSnapshot(Interactable, Snapshot))
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(AMounteaInteractionStateManager, InteractableStates, this);
+	}
+}
+
+void AMounteaInteractionStateManager::RemoveInteractable(const UMounteaInteractableComponentBase* Interactable)
+{
+	if (!HasAuthority()) return;
+
+	if (InteractableStates.Remove(Interactable))
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(AMounteaInteractionStateManager, InteractableStates, this);
+	}
+}
+
+void AMounteaInteractionStateManager::BeginPlay()
+{
+	Super::BeginPlay();
+
+	UMounteaInteractionRegistrySubsystem* Registry = UMounteaInteractionRegistrySubsystem::Get(this);
+	if (!Registry) return;
+
+	Registry->SetInteractionStateManager(this);
+
+	if (!HasAuthority()) return;
+
+	// Interactables which have begun play before this Manager are collected at once
+	for (const auto& Itr : Registry->GetInteractables())
+	{
+		if (UMounteaInteractableComponentBase* Interactable = Itr.Get())
+		{
+			UpdateInteractable(Interactable, Interactable->BuildStateSnapshot());
+		}
+	}
+}
+
+void AMounteaInteractionStateManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UMounteaInteractionRegistrySubsystem* Registry = UMounteaInteractionRegistrySubsystem::Get(this))
+	{
+		if (Registry->GetInteractionStateManager() == this)
+		{
+			Registry->SetInteractionStateManager(nullptr);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AMounteaInteractionStateManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.Condition = COND_None;
+	Params.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMounteaInteractionStateManager, InteractableStates, Params);
+}
@@ -0,0 +1,377 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Subsystems/MounteaHighlightSubsystem.h"
+
+#include "Components/MeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Materials/MaterialInterface.h"
+#include "Materials/MaterialInstanceDynamic.h"
+
+#include "Helpers/MounteaInteractionSystemSettings.h"
+#include "Interfaces/MounteaInteractableInterface.h"
+
+UMounteaHighlightSubsystem* UMounteaHighlightSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UMounteaHighlightSubsystem>() : nullptr;
+}
+
+void UMounteaHighlightSubsystem::RequestHighlight(UMeshComponent* Mesh, const FMounteaHighlightRequest& Request)
+{
+	if (!Mesh || !Request.Requester.IsValid()) return;
+
+	FMeshHighlightEntry& Entry = FindOrAddEntry(Mesh);
+
+	const int32 ExistingIndex = Entry.Requests.IndexOfByPredicate([&Request](const FMounteaHighlightRequest& Itr)
+	{
+		return Itr.Requester == Request.Requester;
+	});
+
+	// Keep most recent request last, so it wins when resolving net state
+	if (ExistingIndex != INDEX_NONE)
+	{
+		Entry.Requests.RemoveAt(ExistingIndex);
+	}
+	Entry.Requests.Add(Request);
+
+	RequestedUpdates += CountRenderUpdates(Request.HighlightType, true);
+	DirtyMeshes.Add(Mesh);
+}
+
+void UMounteaHighlightSubsystem::ClearHighlight(UMeshComponent* Mesh, const UObject* Requester)
+{
+	if (!Mesh || !Requester) return;
+
+	FMeshHighlightEntry* Entry = MeshEntries.Find(Mesh);
+	if (!Entry) return;
+
+	const int32 ExistingIndex = Entry->Requests.IndexOfByPredicate([Requester](const FMounteaHighlightRequest& Itr)
+	{
+		return Itr.Requester.Get() == Requester;
+	});
+	if (ExistingIndex == INDEX_NONE) return;
+
+	RequestedUpdates += CountRenderUpdates(Entry->Requests[ExistingIndex].HighlightType, false);
+
+	Entry->Requests.RemoveAt(ExistingIndex);
+	DirtyMeshes.Add(Mesh);
+}
+
+void UMounteaHighlightSubsystem::FlushHighlights()
+{
+	if (DirtyMeshes.Num() == 0) return;
+
+	// Copy as applying might cause new requests from callbacks
+	const TSet<TObjectKey<UMeshComponent>> MeshesToApply = MoveTemp(DirtyMeshes);
+	DirtyMeshes.Reset();
+
+	for (const auto& Itr : MeshesToApply)
+	{
+		FMeshHighlightEntry* Entry = MeshEntries.Find(Itr);
+		if (!Entry) continue;
+
+		ApplyEntry(*Entry);
+
+		if (Entry->Requests.Num() == 0 || !Entry->Mesh.IsValid())
+		{
+			SetAppliedOverlayMaterial(*Entry, nullptr);
+			MeshEntries.Remove(Itr);
+		}
+	}
+
+	EvictUnusedSharedMaterials();
+}
+
+UMaterialInterface* UMounteaHighlightSubsystem::GetSharedHighlightMaterial(UMaterialInterface* BaseMaterial, const FMounteaHighlightMaterialParameters& Parameters)
+{
+	if (!BaseMaterial || Parameters.IsEmpty()) return BaseMaterial;
+
+	const FSharedMaterialKey Key { BaseMaterial, Parameters };
+	if (const FSharedMaterialEntry* CachedMaterial = SharedMaterials.Find(Key))
+	{
+		return CachedMaterial->Material;
+	}
+
+	UMaterialInstanceDynamic* NewMaterial = UMaterialInstanceDynamic::Create(BaseMaterial, this);
+	if (!NewMaterial) return BaseMaterial;
+
+	for (const auto& Itr : Parameters.ScalarParameters)
+	{
+		NewMaterial->SetScalarParameterValue(Itr.ParameterName, Itr.Value);
+	}
+	for (const auto& Itr : Parameters.VectorParameters)
+	{
+		NewMaterial->SetVectorParameterValue(Itr.ParameterName, Itr.Value);
+	}
+
+	// Unused until first mesh applies it, so it does not outlive a request which never got applied
+	SharedMaterials.Add(Key, { NewMaterial, 0 });
+	SharedMaterialKeys.Add(NewMaterial, Key);
+	UnusedSharedMaterials.Add(Key);
+
+	return NewMaterial;
+}
+
+void UMounteaHighlightSubsystem::StartProgressHighlight(UObject* Requester, const TArray<UMeshComponent*>& Meshes, const FMounteaHighlightRequest& Request, const FMounteaHighlightMaterialParameters& Parameters, const FName& ProgressParameterName)
+{
+	if (!Requester || ProgressParameterName.IsNone()) return;
+
+	FProgressHighlightEntry& Entry = ProgressHighlights.FindOrAdd(Requester);
+	Entry.Requester = Requester;
+	Entry.Request = Request;
+	Entry.BaseMaterial = Request.OverlayMaterial;
+	Entry.Parameters = Parameters;
+	Entry.ProgressParameterName = ProgressParameterName;
+	Entry.LastStep = INDEX_NONE;
+
+	Entry.Meshes.Reset(Meshes.Num());
+	for (UMeshComponent* const Itr : Meshes)
+	{
+		Entry.Meshes.Add(Itr);
+	}
+}
+
+void UMounteaHighlightSubsystem::StopProgressHighlight(const UObject* Requester)
+{
+	ProgressHighlights.Remove(Requester);
+}
+
+void UMounteaHighlightSubsystem::UpdateProgressHighlights()
+{
+	const UMounteaInteractionSystemSettings* Settings = GetDefault<UMounteaInteractionSystemSettings>();
+	const int32 ProgressSteps = FMath::Max(1, Settings->GetHighlightProgressSteps());
+
+	for (auto It = ProgressHighlights.CreateIterator(); It; ++It)
+	{
+		FProgressHighlightEntry& Entry = It.Value();
+
+		UObject* Requester = Entry.Requester.Get();
+		if (!Requester || !Requester->Implements<UMounteaInteractableInterface>() || !Entry.BaseMaterial.IsValid())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		const float Progress = IMounteaInteractableInterface::Execute_GetInteractionProgress(Requester);
+		const int32 Step = FMath::Clamp(FMath::FloorToInt(FMath::Max(0.f, Progress) * ProgressSteps), 0, ProgressSteps);
+		if (Step == Entry.LastStep) continue;
+
+		Entry.LastStep = Step;
+
+		FMounteaHighlightScalarParameter ProgressParameter;
+		ProgressParameter.ParameterName = Entry.ProgressParameterName;
+		ProgressParameter.Value = static_cast<float>(Step) / ProgressSteps;
+
+		FMounteaHighlightMaterialParameters StepParameters = Entry.Parameters;
+		StepParameters.ScalarParameters.Add(ProgressParameter);
+
+		Entry.Request.OverlayMaterial = GetSharedHighlightMaterial(Entry.BaseMaterial.Get(), StepParameters);
+
+		for (const auto& Itr : Entry.Meshes)
+		{
+			RequestHighlight(Itr.Get(), Entry.Request);
+		}
+	}
+}
+
+bool UMounteaHighlightSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UMounteaHighlightSubsystem::Deinitialize()
+{
+	MeshEntries.Empty();
+	DirtyMeshes.Empty();
+	ProgressHighlights.Empty();
+	SharedMaterials.Empty();
+	SharedMaterialKeys.Empty();
+	UnusedSharedMaterials.Empty();
+
+	Super::Deinitialize();
+}
+
+void UMounteaHighlightSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	UMounteaHighlightSubsystem* This = CastChecked<UMounteaHighlightSubsystem>(InThis);
+	for (auto& Itr : This->SharedMaterials)
+	{
+		Collector.AddReferencedObject(Itr.Value.Material, This);
+	}
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
+void UMounteaHighlightSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Progress is resolved first, so its requests are applied within the same flush
+	UpdateProgressHighlights();
+	FlushHighlights();
+}
+
+bool UMounteaHighlightSubsystem::IsTickable() const
+{
+	return DirtyMeshes.Num() > 0 || ProgressHighlights.Num() > 0;
+}
+
+TStatId UMounteaHighlightSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMounteaHighlightSubsystem, STATGROUP_Tickables);
+}
+
+UMounteaHighlightSubsystem::FMeshHighlightEntry& UMounteaHighlightSubsystem::FindOrAddEntry(UMeshComponent* Mesh)
+{
+	FMeshHighlightEntry& Entry = MeshEntries.FindOrAdd(Mesh);
+	Entry.Mesh = Mesh;
+	return Entry;
+}
+
+int32 UMounteaHighlightSubsystem::CountRenderUpdates(const EHighlightType HighlightType, const bool bIsStart)
+{
+	switch (HighlightType)
+	{
+		case EHighlightType::EHT_PostProcessing:
+			// Start sets both Custom Depth and Stencil, Stop resets Stencil only
+			return bIsStart ? 2 : 1;
+		case EHighlightType::EHT_PersistentStencil:
+		case EHighlightType::EHT_OverlayMaterial:
+			return 1;
+		case EHighlightType::EHT_Default:
+		default:
+			return 0;
+	}
+}
+
+void UMounteaHighlightSubsystem::ApplyEntry(FMeshHighlightEntry& Entry)
+{
+	UMeshComponent* Mesh = Entry.Mesh.Get();
+	if (!Mesh) return;
+
+	Entry.Requests.RemoveAll([](const FMounteaHighlightRequest& Itr)
+	{
+		return !Itr.Requester.IsValid();
+	});
+
+	bool bHasStencilRequest = false;
+	bool bHasCustomDepthRequest = false;
+	bool bWantsCustomDepth = false;
+	int32 NetStencilValue = 0;
+
+	bool bHasOverlayRequest = false;
+	UMaterialInterface* NetOverlayMaterial = nullptr;
+
+	for (const auto& Itr : Entry.Requests)
+	{
+		switch (Itr.HighlightType)
+		{
+			case EHighlightType::EHT_PostProcessing:
+				bHasStencilRequest = true;
+				bHasCustomDepthRequest = true;
+				bWantsCustomDepth |= Itr.bRenderCustomDepth;
+				NetStencilValue = Itr.StencilValue;
+				break;
+			case EHighlightType::EHT_PersistentStencil:
+				// Mesh is already in Custom Depth pass, only Stencil is switched
+				bHasStencilRequest = true;
+				NetStencilValue = Itr.StencilValue;
+				break;
+			case EHighlightType::EHT_OverlayMaterial:
+				bHasOverlayRequest = true;
+				NetOverlayMaterial = Itr.OverlayMaterial.Get();
+				break;
+			case EHighlightType::EHT_Default:
+			default:
+				break;
+		}
+	}
+
+	if (bHasStencilRequest)
+	{
+		Entry.bOwnsStencil = true;
+
+		if (bHasCustomDepthRequest && Mesh->bRenderCustomDepth != bWantsCustomDepth)
+		{
+			Mesh->SetRenderCustomDepth(bWantsCustomDepth);
+			AppliedUpdates++;
+		}
+		if (Mesh->CustomDepthStencilValue != NetStencilValue)
+		{
+			Mesh->SetCustomDepthStencilValue(NetStencilValue);
+			AppliedUpdates++;
+		}
+	}
+	else if (Entry.bOwnsStencil)
+	{
+		Entry.bOwnsStencil = false;
+
+		if (Mesh->CustomDepthStencilValue != 0)
+		{
+			Mesh->SetCustomDepthStencilValue(0);
+			AppliedUpdates++;
+		}
+	}
+
+	if (bHasOverlayRequest)
+	{
+		Entry.bOwnsOverlay = true;
+
+		if (Mesh->GetOverlayMaterial() != NetOverlayMaterial)
+		{
+			Mesh->SetOverlayMaterial(NetOverlayMaterial);
+			AppliedUpdates++;
+		}
+		SetAppliedOverlayMaterial(Entry, NetOverlayMaterial);
+	}
+	else if (Entry.bOwnsOverlay)
+	{
+		Entry.bOwnsOverlay = false;
+		SetAppliedOverlayMaterial(Entry, nullptr);
+
+		if (Mesh->GetOverlayMaterial() != nullptr)
+		{
+			Mesh->SetOverlayMaterial(nullptr);
+			AppliedUpdates++;
+		}
+	}
+}
+
+void UMounteaHighlightSubsystem::SetAppliedOverlayMaterial(FMeshHighlightEntry& Entry, UMaterialInterface* Material)
+{
+	const TObjectKey<UMaterialInterface> NewMaterial(Material);
+	if (Entry.AppliedOverlayMaterial == NewMaterial) return;
+
+	if (const FSharedMaterialKey* OldKey = SharedMaterialKeys.Find(Entry.AppliedOverlayMaterial))
+	{
+		FSharedMaterialEntry& SharedMaterial = SharedMaterials.FindChecked(*OldKey);
+		if (--SharedMaterial.MeshCount <= 0)
+		{
+			UnusedSharedMaterials.Add(*OldKey);
+		}
+	}
+
+	if (const FSharedMaterialKey* NewKey = SharedMaterialKeys.Find(NewMaterial))
+	{
+		SharedMaterials.FindChecked(*NewKey).MeshCount++;
+		UnusedSharedMaterials.Remove(*NewKey);
+	}
+
+	Entry.AppliedOverlayMaterial = NewMaterial;
+}
+
+void UMounteaHighlightSubsystem::EvictUnusedSharedMaterials()
+{
+	for (const FSharedMaterialKey& Itr : UnusedSharedMaterials)
+	{
+		FSharedMaterialEntry SharedMaterial;
+		if (SharedMaterials.RemoveAndCopyValue(Itr, SharedMaterial))
+		{
+			SharedMaterialKeys.Remove(SharedMaterial.Material.Get());
+		}
+	}
+	UnusedSharedMaterials.Reset();
+}
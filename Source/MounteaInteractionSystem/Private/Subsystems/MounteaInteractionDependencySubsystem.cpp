@@ -0,0 +1,348 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Subsystems/MounteaInteractionDependencySubsystem.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+#include "Helpers/MounteaInteractionSystemLog.h"
+#include "Interfaces/MounteaInteractableInterface.h"
+#include "Interfaces/MounteaInteractorInterface.h"
+
+UMounteaInteractionDependencySubsystem* UMounteaInteractionDependencySubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UMounteaInteractionDependencySubsystem>() : nullptr;
+}
+
+bool UMounteaInteractionDependencySubsystem::AddDependency(const UObject* Master, const UObject* Dependency)
+{
+	check(IsInGameThread());
+
+	if (!Master || !Dependency) return false;
+
+	if (WouldCreateCycle(Master, Dependency))
+	{
+		LOG_ERROR(TEXT("[AddDependency] %s cannot depend on %s, as it would create a cycle!"), *GetNameSafe(Dependency), *GetNameSafe(Master))
+		return false;
+	}
+
+	FDependencyNode& MasterNode = FindOrAddNode(Master);
+	if (MasterNode.Dependencies.Contains(Dependency)) return true;
+	MasterNode.Dependencies.Add(Dependency);
+
+	// Master Node reference might be invalidated by adding another Node
+	FindOrAddNode(Dependency).Masters.Add(Master);
+
+	return true;
+}
+
+void UMounteaInteractionDependencySubsystem::RemoveDependency(const UObject* Master, const UObject* Dependency)
+{
+	check(IsInGameThread());
+
+	const TObjectKey<UObject> MasterKey(Master);
+	const TObjectKey<UObject> DependencyKey(Dependency);
+
+	if (FDependencyNode* MasterNode = Nodes.Find(MasterKey))
+	{
+		MasterNode->Dependencies.Remove(DependencyKey);
+	}
+	if (FDependencyNode* DependencyNode = Nodes.Find(DependencyKey))
+	{
+		DependencyNode->Masters.Remove(MasterKey);
+	}
+
+	RemoveNodeIfUnused(MasterKey);
+	RemoveNodeIfUnused(DependencyKey);
+}
+
+void UMounteaInteractionDependencySubsystem::RemoveNode(const UObject* Node)
+{
+	check(IsInGameThread());
+
+	const TObjectKey<UObject> Key(Node);
+
+	FDependencyNode RemovedNode;
+	if (!Nodes.RemoveAndCopyValue(Key, RemovedNode)) return;
+
+	DirtyNodes.Remove(Key);
+
+	for (const TObjectKey<UObject>& Itr : RemovedNode.Dependencies)
+	{
+		if (FDependencyNode* DependencyNode = Nodes.Find(Itr))
+		{
+			DependencyNode->Masters.Remove(Key);
+		}
+		RemoveNodeIfUnused(Itr);
+	}
+
+	for (const TObjectKey<UObject>& Itr : RemovedNode.Masters)
+	{
+		if (FDependencyNode* MasterNode = Nodes.Find(Itr))
+		{
+			MasterNode->Dependencies.Remove(Key);
+		}
+		RemoveNodeIfUnused(Itr);
+	}
+}
+
+bool UMounteaInteractionDependencySubsystem::WouldCreateCycle(const UObject* Master, const UObject* Dependency) const
+{
+	if (Master == Dependency) return true;
+
+	// Cycle is closed only if Master is already reachable from Dependency
+	const TObjectKey<UObject> MasterKey(Master);
+
+	TArray<TObjectKey<UObject>, TInlineAllocator<16>> Stack;
+	TSet<TObjectKey<UObject>> Visited;
+	Stack.Add(Dependency);
+
+	while (Stack.Num() > 0)
+	{
+		const TObjectKey<UObject> Key = Stack.Pop(EAllowShrinking::No);
+		if (Key == MasterKey) return true;
+
+		bool bAlreadyVisited = false;
+		Visited.Add(Key, &bAlreadyVisited);
+		if (bAlreadyVisited) continue;
+
+		if (const FDependencyNode* Node = Nodes.Find(Key))
+		{
+			Stack.Append(Node->Dependencies);
+		}
+	}
+
+	return false;
+}
+
+bool UMounteaInteractionDependencySubsystem::MarkDirty(const UObject* Master)
+{
+	const FDependencyNode* Node = Nodes.Find(Master);
+	if (!Node || Node->Dependencies.Num() == 0) return false;
+
+	bool bAlreadyDirty = false;
+	DirtyNodes.Add(Master, &bAlreadyDirty);
+	if (bAlreadyDirty)
+	{
+		MergedRequests++;
+	}
+
+	return true;
+}
+
+void UMounteaInteractionDependencySubsystem::FlushDependencies()
+{
+	// Nodes marked dirty by processing are already part of the current order
+	if (bIsFlushing || DirtyNodes.Num() == 0) return;
+
+	TGuardValue<bool> FlushingGuard(bIsFlushing, true);
+
+	TArray<TObjectKey<UObject>> Order;
+	SortDirtyNodes(Order);
+
+	for (const TObjectKey<UObject>& Key : Order)
+	{
+		// Only Nodes whose State might have changed need to propagate it
+		if (DirtyNodes.Remove(Key) == 0) continue;
+
+		const FDependencyNode* Node = Nodes.Find(Key);
+		UObject* Object = Node ? Node->Object.Get() : nullptr;
+		if (!Object) continue;
+
+		ProcessedNodes++;
+
+		if (Object->Implements<UMounteaInteractableInterface>())
+		{
+			IMounteaInteractableInterface::Execute_ProcessDependencies(Object);
+		}
+		else if (Object->Implements<UMounteaInteractorInterface>())
+		{
+			IMounteaInteractorInterface::Execute_ProcessDependencies(Object);
+		}
+	}
+}
+
+TArray<UObject*> UMounteaInteractionDependencySubsystem::GetDependencies(const UObject* Master) const
+{
+	TArray<UObject*> Result;
+	if (const FDependencyNode* Node = Nodes.Find(Master))
+	{
+		for (const TObjectKey<UObject>& Itr : Node->Dependencies)
+		{
+			if (UObject* Object = Itr.ResolveObjectPtr())
+			{
+				Result.Add(Object);
+			}
+		}
+	}
+	return Result;
+}
+
+TArray<UObject*> UMounteaInteractionDependencySubsystem::GetMasters(const UObject* Dependency) const
+{
+	TArray<UObject*> Result;
+	if (const FDependencyNode* Node = Nodes.Find(Dependency))
+	{
+		for (const TObjectKey<UObject>& Itr : Node->Masters)
+		{
+			if (UObject* Object = Itr.ResolveObjectPtr())
+			{
+				Result.Add(Object);
+			}
+		}
+	}
+	return Result;
+}
+
+FString UMounteaInteractionDependencySubsystem::DescribeGraph() const
+{
+	TStringBuilder<1024> Builder;
+	Builder.Appendf(TEXT("Nodes: %d, Dirty: %d, Processed: %d, Merged: %d"), Nodes.Num(), DirtyNodes.Num(), ProcessedNodes, MergedRequests);
+
+	for (const auto& Itr : Nodes)
+	{
+		if (Itr.Value.Dependencies.Num() == 0) continue;
+
+		Builder.Appendf(TEXT("\n%s%s ->"), *GetNameSafe(Itr.Value.Object.Get()), DirtyNodes.Contains(Itr.Key) ? TEXT(" (dirty)") : TEXT(""));
+		for (const TObjectKey<UObject>& Dependency : Itr.Value.Dependencies)
+		{
+			Builder.Appendf(TEXT(" %s"), *GetNameSafe(Dependency.ResolveObjectPtr()));
+		}
+	}
+
+	return Builder.ToString();
+}
+
+bool UMounteaInteractionDependencySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UMounteaInteractionDependencySubsystem::Deinitialize()
+{
+	Nodes.Empty();
+	DirtyNodes.Empty();
+
+	Super::Deinitialize();
+}
+
+void UMounteaInteractionDependencySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	FlushDependencies();
+}
+
+bool UMounteaInteractionDependencySubsystem::IsTickable() const
+{
+	return DirtyNodes.Num() > 0;
+}
+
+TStatId UMounteaInteractionDependencySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMounteaInteractionDependencySubsystem, STATGROUP_Tickables);
+}
+
+UMounteaInteractionDependencySubsystem::FDependencyNode& UMounteaInteractionDependencySubsystem::FindOrAddNode(const UObject* Object)
+{
+	FDependencyNode& Node = Nodes.FindOrAdd(Object);
+	Node.Object = const_cast<UObject*>(Object);
+	return Node;
+}
+
+void UMounteaInteractionDependencySubsystem::RemoveNodeIfUnused(const TObjectKey<UObject>& Key)
+{
+	const FDependencyNode* Node = Nodes.Find(Key);
+	if (Node && Node->Dependencies.Num() == 0 && Node->Masters.Num() == 0)
+	{
+		Nodes.Remove(Key);
+		DirtyNodes.Remove(Key);
+	}
+}
+
+void UMounteaInteractionDependencySubsystem::SortDirtyNodes(TArray<TObjectKey<UObject>>& OutOrder) const
+{
+	// Collect subgraph reachable from dirty Nodes, counting Masters within it
+	TMap<TObjectKey<UObject>, int32> PendingMasters;
+	TArray<TObjectKey<UObject>> Stack = DirtyNodes.Array();
+
+	while (Stack.Num() > 0)
+	{
+		const TObjectKey<UObject> Key = Stack.Pop(EAllowShrinking::No);
+
+		if (PendingMasters.Contains(Key)) continue;
+		PendingMasters.Add(Key, 0);
+
+		if (const FDependencyNode* Node = Nodes.Find(Key))
+		{
+			Stack.Append(Node->Dependencies);
+		}
+	}
+
+	for (const auto& Itr : PendingMasters)
+	{
+		if (const FDependencyNode* Node = Nodes.Find(Itr.Key))
+		{
+			for (const TObjectKey<UObject>& Dependency : Node->Dependencies)
+			{
+				PendingMasters[Dependency]++;
+			}
+		}
+	}
+
+	// Kahn's algorithm, Node is ready once all of its Masters within the subgraph are ordered
+	OutOrder.Reserve(PendingMasters.Num());
+	for (const auto& Itr : PendingMasters)
+	{
+		if (Itr.Value == 0)
+		{
+			OutOrder.Add(Itr.Key);
+		}
+	}
+
+	for (int32 Index = 0; Index < OutOrder.Num(); Index++)
+	{
+		if (const FDependencyNode* Node = Nodes.Find(OutOrder[Index]))
+		{
+			for (const TObjectKey<UObject>& Dependency : Node->Dependencies)
+			{
+				if (--PendingMasters[Dependency] == 0)
+				{
+					OutOrder.Add(Dependency);
+				}
+			}
+		}
+	}
+
+	// Cycles are refused on insertion, so every Node must have been ordered
+	ensureMsgf(OutOrder.Num() == PendingMasters.Num(), TEXT("Interaction Dependency graph contains a cycle!"));
+}
+
+#pragma region Debug
+
+#if !UE_BUILD_SHIPPING
+
+static FAutoConsoleCommandWithWorld DumpDependencyGraphCommand
+(
+	TEXT("Mountea.Interaction.DumpDependencyGraph"),
+	TEXT("Logs all Interaction Dependencies of this World. Usage: Mountea.Interaction.DumpDependencyGraph"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		const UMounteaInteractionDependencySubsystem* DependencySubsystem = UMounteaInteractionDependencySubsystem::Get(World);
+		if (!DependencySubsystem)
+		{
+			UE_LOG(LogActorInteraction, Warning, TEXT("[DumpDependencyGraph] No Dependency Subsystem in this World!"))
+			return;
+		}
+
+		UE_LOG(LogActorInteraction, Display, TEXT("[DumpDependencyGraph] %s"), *DependencySubsystem->DescribeGraph())
+	})
+);
+
+#endif
+
+#pragma endregion
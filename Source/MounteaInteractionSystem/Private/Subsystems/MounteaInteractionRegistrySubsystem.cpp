@@ -0,0 +1,282 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Subsystems/MounteaInteractionRegistrySubsystem.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "TimerManager.h"
+
+#include "Components/Interactable/MounteaInteractableComponentBase.h"
+#include "Components/Interactable/MounteaInteractableComponentPress.h"
+#include "Components/Interactor/MounteaInteractorComponentBase.h"
+#include "Helpers/MounteaInteractionSystemLog.h"
+#include "Helpers/MounteaInteractionSystemSettings.h"
+#include "Interfaces/MounteaInteractableInterface.h"
+#include "Interfaces/MounteaInteractorInterface.h"
+#include "Networking/MounteaInteractionStateManager.h"
+
+UMounteaInteractionRegistrySubsystem::FHandleSlots UMounteaInteractionRegistrySubsystem::InteractableSlots;
+UMounteaInteractionRegistrySubsystem::FHandleSlots UMounteaInteractionRegistrySubsystem::InteractorSlots;
+
+UMounteaInteractionRegistrySubsystem* UMounteaInteractionRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UMounteaInteractionRegistrySubsystem>() : nullptr;
+}
+
+void UMounteaInteractionRegistrySubsystem::RegisterInteractable(UMounteaInteractableComponentBase* Interactable)
+{
+	Interactables.Add(Interactable);
+}
+
+void UMounteaInteractionRegistrySubsystem::UnregisterInteractable(UMounteaInteractableComponentBase* Interactable)
+{
+	Interactables.Remove(Interactable);
+	PendingInteractables.Remove(Interactable);
+}
+
+bool UMounteaInteractionRegistrySubsystem::QueueInteractableRegistration(UMounteaInteractableComponentBase* Interactable)
+{
+	if (!Interactable || !GetDefault<UMounteaInteractionSystemSettings>()->IsInteractableRegistrationTimeSliced()) return false;
+
+	PendingInteractables.Add(Interactable);
+	SchedulePendingRegistrations();
+	
+	return true;
+}
+
+void UMounteaInteractionRegistrySubsystem::ProcessPendingRegistrations()
+{
+	bPendingRegistrationsScheduled = false;
+
+	const double Budget = GetDefault<UMounteaInteractionSystemSettings>()->GetInteractableRegistrationBudget() / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	// At least one Interactable per frame, so the queue is always drained
+	bool bFirst = true;
+	while (PendingInteractables.Num() > 0 && (bFirst || FPlatformTime::Seconds() - StartTime < Budget))
+	{
+		// Removed before completing, as Interactable might unregister itself during its setup
+		const TWeakObjectPtr<UMounteaInteractableComponentBase> PendingInteractable = PendingInteractables[0];
+		PendingInteractables.RemoveAt(0, 1, EAllowShrinking::No);
+
+		if (UMounteaInteractableComponentBase* Interactable = PendingInteractable.Get())
+		{
+			Interactable->CompleteRegistration();
+			bFirst = false;
+		}
+	}
+
+	if (PendingInteractables.Num() > 0)
+	{
+		SchedulePendingRegistrations();
+	}
+}
+
+void UMounteaInteractionRegistrySubsystem::SchedulePendingRegistrations()
+{
+	if (bPendingRegistrationsScheduled) return;
+
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	bPendingRegistrationsScheduled = true;
+	World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UMounteaInteractionRegistrySubsystem::ProcessPendingRegistrations));
+}
+
+void UMounteaInteractionRegistrySubsystem::RegisterInteractor(UMounteaInteractorComponentBase* Interactor)
+{
+	Interactors.Add(Interactor);
+}
+
+void UMounteaInteractionRegistrySubsystem::UnregisterInteractor(UMounteaInteractorComponentBase* Interactor)
+{
+	Interactors.Remove(Interactor);
+}
+
+FMounteaInteractableHandle UMounteaInteractionRegistrySubsystem::AcquireInteractableHandle(const UObject* Interactable)
+{
+	check(IsInGameThread());
+	
+	if (!Interactable || !Interactable->Implements<UMounteaInteractableInterface>()) return FMounteaInteractableHandle();
+
+	const int32 Index = InteractableSlots.Acquire(Interactable);
+	return FMounteaInteractableHandle(Index, InteractableSlots.Generations[Index]);
+}
+
+void UMounteaInteractionRegistrySubsystem::ReleaseInteractableHandle(const UObject* Interactable)
+{
+	check(IsInGameThread());
+	
+	InteractableSlots.Release(Interactable);
+}
+
+UObject* UMounteaInteractionRegistrySubsystem::ResolveInteractableHandle(const FMounteaInteractableHandle& Handle)
+{
+	return const_cast<UObject*>(InteractableSlots.Resolve(Handle.Index, Handle.Generation));
+}
+
+FMounteaInteractorHandle UMounteaInteractionRegistrySubsystem::AcquireInteractorHandle(const UObject* Interactor)
+{
+	check(IsInGameThread());
+	
+	if (!Interactor || !Interactor->Implements<UMounteaInteractorInterface>()) return FMounteaInteractorHandle();
+
+	const int32 Index = InteractorSlots.Acquire(Interactor);
+	return FMounteaInteractorHandle(Index, InteractorSlots.Generations[Index]);
+}
+
+void UMounteaInteractionRegistrySubsystem::ReleaseInteractorHandle(const UObject* Interactor)
+{
+	check(IsInGameThread());
+	
+	InteractorSlots.Release(Interactor);
+}
+
+UObject* UMounteaInteractionRegistrySubsystem::ResolveInteractorHandle(const FMounteaInteractorHandle& Handle)
+{
+	return const_cast<UObject*>(InteractorSlots.Resolve(Handle.Index, Handle.Generation));
+}
+
+int32 UMounteaInteractionRegistrySubsystem::FHandleSlots::Acquire(const UObject* Object)
+{
+	if (const int32* ExistingIndex = Indices.Find(Object))
+	{
+		return *ExistingIndex;
+	}
+
+	int32 Index = INDEX_NONE;
+	if (FreeIndices.Num() > 0)
+	{
+		Index = FreeIndices.Pop(EAllowShrinking::No);
+		Objects[Index] = Object;
+	}
+	else
+	{
+		Index = Objects.Add(Object);
+		Generations.Add(1);
+	}
+
+	Indices.Add(Object, Index);
+	return Index;
+}
+
+void UMounteaInteractionRegistrySubsystem::FHandleSlots::Release(const UObject* Object)
+{
+	int32 Index = INDEX_NONE;
+	if (!Object || !Indices.RemoveAndCopyValue(Object, Index)) return;
+
+	Objects[Index].Reset();
+	
+	// Zero marks invalid Handle, so it is skipped once Generation wraps around
+	Generations[Index] = FMath::Max(1u, Generations[Index] + 1);
+	FreeIndices.Add(Index);
+}
+
+void UMounteaInteractionRegistrySubsystem::FHandleSlots::ReleaseStale()
+{
+	for (auto It = Indices.CreateIterator(); It; ++It)
+	{
+		const int32 Index = It.Value();
+		if (Objects[Index].IsValid()) continue;
+
+		Generations[Index] = FMath::Max(1u, Generations[Index] + 1);
+		FreeIndices.Add(Index);
+		It.RemoveCurrent();
+	}
+}
+
+bool UMounteaInteractionRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UMounteaInteractionRegistrySubsystem::Deinitialize()
+{
+	Interactables.Empty();
+	Interactors.Empty();
+	PendingInteractables.Empty();
+	InteractionStateManager.Reset();
+
+	// Objects implementing Interfaces outside of base Components do not release their Handles
+	InteractableSlots.ReleaseStale();
+	InteractorSlots.ReleaseStale();
+
+	Super::Deinitialize();
+}
+
+void UMounteaInteractionRegistrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Clients receive replicated Manager, Standalone has nothing to replicate
+	const ENetMode NetMode = InWorld.GetNetMode();
+	if (NetMode == NM_Client || NetMode == NM_Standalone) return;
+
+	if (!GetDefault<UMounteaInteractionSystemSettings>()->IsInteractionStateManagerEnabled()) return;
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+	
+	InWorld.SpawnActor<AMounteaInteractionStateManager>(SpawnParameters);
+}
+
+#pragma region Benchmark
+
+#if !UE_BUILD_SHIPPING
+
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkInteractableSpawnCommand
+(
+	TEXT("Mountea.Interaction.BenchmarkSpawn"),
+	TEXT("Spawns Actors with Interactable Component in one frame and measures spawn cost. Usage: Mountea.Interaction.BenchmarkSpawn [Count]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World || !World->HasBegunPlay())
+		{
+			UE_LOG(LogActorInteraction, Warning, TEXT("[BenchmarkSpawn] World has not begun play!"))
+			return;
+		}
+
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 500;
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.ObjectFlags |= RF_Transient;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		TArray<AActor*> SpawnedActors;
+		SpawnedActors.Reserve(Count);
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			AActor* Actor = World->SpawnActor<AActor>(SpawnParameters);
+			if (!Actor) continue;
+
+			// Component registered on Actor which has begun play begins play right away
+			UMounteaInteractableComponentPress* Interactable = NewObject<UMounteaInteractableComponentPress>(Actor);
+			Actor->SetRootComponent(Interactable);
+			Interactable->RegisterComponent();
+
+			SpawnedActors.Add(Actor);
+		}
+		const double SpawnMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		const UMounteaInteractionRegistrySubsystem* Registry = UMounteaInteractionRegistrySubsystem::Get(World);
+		const int32 PendingCount = Registry ? Registry->GetPendingInteractablesCount() : 0;
+
+		UE_LOG(LogActorInteraction, Display, TEXT("[BenchmarkSpawn] %d Interactables: %.2f ms total, %.4f ms/spawn, %d registrations deferred"),
+			SpawnedActors.Num(), SpawnMilliseconds, SpawnMilliseconds / FMath::Max(1, SpawnedActors.Num()), PendingCount)
+
+		for (AActor* Actor : SpawnedActors)
+		{
+			Actor->Destroy();
+		}
+	})
+);
+
+#endif
+
+#pragma endregion
@@ -0,0 +1,119 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Subsystems/MounteaServerRPCLimiterSubsystem.h"
+
+#include "Engine/Engine.h"
+#include "Engine/NetConnection.h"
+#include "Engine/World.h"
+
+#include "Helpers/MounteaInteractionSystemSettings.h"
+#include "Helpers/MounteaInteractionSystemStats.h"
+
+namespace MounteaServerRPCLimiter
+{
+	/** How often are Buckets of closed Connections removed, in seconds. */
+	constexpr double PruneInterval = 30.0;
+}
+
+UMounteaServerRPCLimiterSubsystem* UMounteaServerRPCLimiterSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UMounteaServerRPCLimiterSubsystem>() : nullptr;
+}
+
+bool UMounteaServerRPCLimiterSubsystem::ConsumeToken(const UNetConnection* Connection, const EMounteaServerRPCType RPCType, const float MinTokensPerSecond)
+{
+	if (!Connection || RPCType >= EMounteaServerRPCType::Default) return true;
+
+	const UMounteaInteractionSystemSettings* Settings = GetDefault<UMounteaInteractionSystemSettings>();
+	const FMounteaServerRPCBudget* Budget = Settings->FindServerRPCBudget(RPCType);
+	if (!Budget) return true;
+
+	// Real time, so paused or dilated World does not change the budget
+	const double Now = GetWorld()->GetRealTimeSeconds();
+	if (Now - LastPruneTime > MounteaServerRPCLimiter::PruneInterval)
+	{
+		PruneConnections(Now);
+	}
+
+	FTokenBucket& Bucket = ConnectionBuckets.FindOrAdd(Connection).Buckets[static_cast<int32>(RPCType)];
+	const float TokensPerSecond = FMath::Max3(0.1f, Budget->TokensPerSecond, MinTokensPerSecond);
+	const float BurstSize = FMath::Max(static_cast<float>(FMath::Max(1, Budget->BurstSize)), FMath::CeilToFloat(MinTokensPerSecond));
+	
+	if (Bucket.Tokens < 0.f)
+	{
+		Bucket.Tokens = BurstSize;
+	}
+	else
+	{
+		const float Refill = static_cast<float>(Now - Bucket.LastRefillTime) * TokensPerSecond;
+		Bucket.Tokens = FMath::Min(BurstSize, Bucket.Tokens + Refill);
+	}
+	Bucket.LastRefillTime = Now;
+
+	if (Bucket.Tokens < 1.f)
+	{
+		DroppedCounts[static_cast<int32>(RPCType)]++;
+		INC_DWORD_STAT(STAT_MounteaDroppedServerRPCs);
+		return false;
+	}
+
+	Bucket.Tokens -= 1.f;
+	return true;
+}
+
+float UMounteaServerRPCLimiterSubsystem::GetTokenInterval(const EMounteaServerRPCType RPCType) const
+{
+	const FMounteaServerRPCBudget* Budget = GetDefault<UMounteaInteractionSystemSettings>()->FindServerRPCBudget(RPCType);
+	return Budget ? 1.f / FMath::Max(0.1f, Budget->TokensPerSecond) : 0.f;
+}
+
+int32 UMounteaServerRPCLimiterSubsystem::GetDroppedCount(const EMounteaServerRPCType RPCType) const
+{
+	return DroppedCounts.IsValidIndex(static_cast<int32>(RPCType)) ? DroppedCounts[static_cast<int32>(RPCType)] : 0;
+}
+
+int32 UMounteaServerRPCLimiterSubsystem::GetTotalDroppedCount() const
+{
+	int32 TotalCount = 0;
+	for (const int32 Itr : DroppedCounts)
+	{
+		TotalCount += Itr;
+	}
+	return TotalCount;
+}
+
+bool UMounteaServerRPCLimiterSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UMounteaServerRPCLimiterSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	DroppedCounts.SetNumZeroed(static_cast<int32>(EMounteaServerRPCType::Default));
+}
+
+void UMounteaServerRPCLimiterSubsystem::Deinitialize()
+{
+	ConnectionBuckets.Empty();
+	DroppedCounts.Empty();
+
+	Super::Deinitialize();
+}
+
+void UMounteaServerRPCLimiterSubsystem::PruneConnections(const double Now)
+{
+	LastPruneTime = Now;
+
+	for (auto It = ConnectionBuckets.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
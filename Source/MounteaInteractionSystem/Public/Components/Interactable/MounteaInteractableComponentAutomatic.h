@@ -28,7 +28,7 @@ public:
 
 protected:
 
-	virtual void BeginPlay() override;
+	virtual const FMounteaInteractableEventHandlers& GetEventHandlers() const override;
 	
 	virtual void OnInteractionCompletedCallback();
 
@@ -42,6 +42,12 @@ public:
 	virtual FInteractionStarted& GetOnInteractionStartedHandle() override;
 	virtual FInteractionStopped& GetOnInteractionStoppedHandle() override;
 
+	// Interactors cannot start nor stop Automatic interaction, it starts once selected
+	virtual void BroadcastInteractionStarted(const float& TimeStarted, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor) override
+	{ IMounteaInteractableInterface::BroadcastInteractionStarted(TimeStarted, CausingInteractor); };
+	virtual void BroadcastInteractionStopped(const float& TimeStopped, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor) override
+	{ IMounteaInteractableInterface::BroadcastInteractionStopped(TimeStopped, CausingInteractor); };
+
 private:
 
 	FInteractionStarted EmptyHandle_Started;
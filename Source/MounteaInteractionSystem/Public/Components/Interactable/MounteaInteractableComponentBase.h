@@ -9,13 +9,74 @@
 #include "Interfaces/MounteaInteractableInterface.h"
 #include "Helpers/MounteaInteractionHelpers.h"
 #include "Helpers/MounteaInteractionHelperEvents.h"
+#include "Helpers/MounteaInteractableStateList.h"
+#include "Helpers/MounteaInteractionHandles.h"
+#include "Helpers/MounteaInteractionFilterKey.h"
+#include "Helpers/MounteaInteractionNativeDispatch.h"
+#include "Helpers/MounteaInteractionStateMachine.h"
 
 #include "MounteaInteractableComponentBase.generated.h"
 
 class UInputMappingContext;
+class UMounteaInteractableComponentBase;
+struct FStreamableHandle;
+struct FMounteaInteractableSetupTemplate;
 enum class ECommonInputType : uint8;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnWidgetUpdated);
+DECLARE_MULTICAST_DELEGATE(FOnWidgetUpdatedNative);
+
+/**
+ * Own handlers of Interactable events.
+ *
+ * Single static table is shared by all instances of a Class, so Interactables do not bind any delegate to themselves.
+ * Handler is called before Native and Dynamic listeners of its event. Null handler is skipped.
+ */
+struct FMounteaInteractableEventHandlers
+{
+	// Interaction Events
+	void (*InteractableSelected)(UMounteaInteractableComponentBase*, const TScriptInterface<IMounteaInteractableInterface>&) = nullptr;
+	void (*InteractorFound)(UMounteaInteractableComponentBase*, const TScriptInterface<IMounteaInteractorInterface>&) = nullptr;
+	void (*InteractorLost)(UMounteaInteractableComponentBase*, const TScriptInterface<IMounteaInteractorInterface>&) = nullptr;
+	void (*InteractorTraced)(UMounteaInteractableComponentBase*, UPrimitiveComponent*, AActor*, UPrimitiveComponent*, FVector, const FHitResult&) = nullptr;
+	void (*InteractorOverlapped)(UMounteaInteractableComponentBase*, UPrimitiveComponent*, AActor*, UPrimitiveComponent*, int32, bool, const FHitResult&) = nullptr;
+	void (*InteractorStopOverlap)(UMounteaInteractableComponentBase*, UPrimitiveComponent*, AActor*, UPrimitiveComponent*, int32) = nullptr;
+	void (*InteractionCompleted)(UMounteaInteractableComponentBase*, const float&, const TScriptInterface<IMounteaInteractorInterface>&) = nullptr;
+	void (*InteractionCycleCompleted)(UMounteaInteractableComponentBase*, const float&, const int32, const TScriptInterface<IMounteaInteractorInterface>&) = nullptr;
+	void (*InteractionStarted)(UMounteaInteractableComponentBase*, const float&, const TScriptInterface<IMounteaInteractorInterface>&) = nullptr;
+	void (*InteractionStopped)(UMounteaInteractableComponentBase*, const float&, const TScriptInterface<IMounteaInteractorInterface>&) = nullptr;
+	void (*InteractionCanceled)(UMounteaInteractableComponentBase*) = nullptr;
+	void (*LifecycleCompleted)(UMounteaInteractableComponentBase*) = nullptr;
+	void (*CooldownCompleted)(UMounteaInteractableComponentBase*) = nullptr;
+
+	// Attributes Events
+	void (*InteractableDependencyChanged)(UMounteaInteractableComponentBase*, const TScriptInterface<IMounteaInteractableInterface>&) = nullptr;
+	void (*InteractableAutoSetupChanged)(UMounteaInteractableComponentBase*, const bool) = nullptr;
+	void (*InteractableWeightChanged)(UMounteaInteractableComponentBase*, const int32&) = nullptr;
+	void (*InteractableStateChanged)(UMounteaInteractableComponentBase*, const EInteractableStateV2&) = nullptr;
+	void (*InteractableOwnerChanged)(UMounteaInteractableComponentBase*, const AActor*) = nullptr;
+	void (*InteractableCollisionChannelChanged)(UMounteaInteractableComponentBase*, const ECollisionChannel) = nullptr;
+	void (*LifecycleModeChanged)(UMounteaInteractableComponentBase*, const EInteractableLifecycle&) = nullptr;
+	void (*LifecycleCountChanged)(UMounteaInteractableComponentBase*, const int32) = nullptr;
+	void (*CooldownPeriodChanged)(UMounteaInteractableComponentBase*, const float) = nullptr;
+	void (*InteractorChanged)(UMounteaInteractableComponentBase*, const TScriptInterface<IMounteaInteractorInterface>&) = nullptr;
+
+	// Ignored Classes, Highlight and Collision Events
+	void (*IgnoredInteractorClassAdded)(UMounteaInteractableComponentBase*, const TSoftClassPtr<UObject>&) = nullptr;
+	void (*IgnoredInteractorClassRemoved)(UMounteaInteractableComponentBase*, const TSoftClassPtr<UObject>&) = nullptr;
+	void (*HighlightableComponentAdded)(UMounteaInteractableComponentBase*, const UMeshComponent*) = nullptr;
+	void (*HighlightableComponentRemoved)(UMounteaInteractableComponentBase*, const UMeshComponent*) = nullptr;
+	void (*CollisionComponentAdded)(UMounteaInteractableComponentBase*, const UPrimitiveComponent*) = nullptr;
+	void (*CollisionComponentRemoved)(UMounteaInteractableComponentBase*, const UPrimitiveComponent*) = nullptr;
+	void (*HighlightTypeChanged)(UMounteaInteractableComponentBase*, const EHighlightType&) = nullptr;
+	void (*HighlightMaterialChanged)(UMounteaInteractableComponentBase*, const UMaterialInterface*) = nullptr;
+
+	// Widget, Dependency and Input Events
+	void (*WidgetUpdated)(UMounteaInteractableComponentBase*) = nullptr;
+	void (*InteractableDependencyStarted)(UMounteaInteractableComponentBase*, const TScriptInterface<IMounteaInteractableInterface>&) = nullptr;
+	void (*InteractableDependencyStopped)(UMounteaInteractableComponentBase*, const TScriptInterface<IMounteaInteractableInterface>&) = nullptr;
+	void (*InteractionDeviceChanged)(UMounteaInteractableComponentBase*, const ECommonInputType, const FName&) = nullptr;
+};
 
 
 /**
@@ -37,15 +98,98 @@ public:
 
 	UMounteaInteractableComponentBase();
 
+	/**
+	 * Returns replicated values which differ from values this Interactable has been loaded with.
+	 * Used by Interaction State Manager.
+	 */
+	FMounteaInteractableStateSnapshot BuildStateSnapshot() const;
+	/**
+	 * Applies Snapshot received from Interaction State Manager on Client.
+	 * Values missing in Snapshot are reset to loaded ones.
+	 * Snapshot received before BeginPlay is applied once the Interactable begins play.
+	 */
+	void ApplyStateSnapshot(const FMounteaInteractableStateSnapshot& Snapshot);
+
+	/**
+	 * Returns Handle of this Interactable.
+	 * Handle is acquired on first use and released in EndPlay.
+	 */
+	FMounteaInteractableHandle GetInteractableHandle() const;
+
+	/**
+	 * Returns whether Function can be called directly instead of through Execute_ thunk.
+	 * Resolved once this Component begins play, false before.
+	 */
+	bool CanDispatchNatively(const EMounteaInteractableNativeFunction Function) const
+	{ return (NativeDispatchFunctions & (1u << static_cast<uint8>(Function))) != 0; };
+
+	/**
+	 * Returns Filter Key compiled from Collision Channel and Compatible Tags.
+	 * Compiled on first use after either of them changes.
+	 */
+	const FMounteaInteractionFilterKey& GetFilterKey() const;
+
+	/**
+	 * Replaces own event handlers of this instance only, so single handlers can be disabled without subclassing.
+	 * Start from GetActiveEventHandlers and set handlers to opt out of to null.
+	 */
+	void SetInstanceEventHandlers(const FMounteaInteractableEventHandlers& NewHandlers);
+	/** Restores own event handlers of this Class. */
+	void ResetInstanceEventHandlers();
+	/** Returns own event handlers used by this instance. */
+	const FMounteaInteractableEventHandlers& GetActiveEventHandlers() const
+	{ return InstanceEventHandlers.IsValid() ? *InstanceEventHandlers : GetEventHandlers(); };
+
+	/**
+	 * Reverts locally applied Cosmetic State.
+	 * Called on Connection which stopped owning this Interactable, as Owner only Cosmetic State would never reach it cleared.
+	 */
+	void ReleaseCosmeticState();
+
+	/**
+	 * Returns whether Interactor Class, or any of its parents, is in Ignored Classes.
+	 * Ignored Classes are resolved once loaded, result is then cached per Interactor Class.
+	 */
+	bool IsInteractorClassIgnored(const UClass* InteractorClass) const;
+
+	/**
+	 * Registers this Interactable in Interaction Registry and runs Auto Setup.
+	 * Called from BeginPlay, or later by Registry if Interactable registration is time-sliced.
+	 */
+	void CompleteRegistration();
+
 protected:
 	
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void InitWidget() override;
 
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	virtual void OnComponentCreated() override;
 	virtual void OnRegister() override;
+	virtual void Activate(bool bReset = false) override;
+
+	/**
+	 * Returns table of own event handlers of this Class.
+	 * Child Classes opt out of a handler by overriding this and returning a static copy of Super's table with that handler set to null.
+	 * Single instances opt out through SetInstanceEventHandlers instead.
+	 */
+	virtual const FMounteaInteractableEventHandlers& GetEventHandlers() const
+	{ return GetDefaultEventHandlers(); };
+	static const FMounteaInteractableEventHandlers& GetDefaultEventHandlers();
+
+	/** Calls own Handler of the event and then broadcasts its Native and Dynamic delegates. */
+	template<typename HandlerType, typename NativeDelegateType, typename DynamicDelegateType, typename... ParamTypes>
+	void BroadcastEvent(HandlerType FMounteaInteractableEventHandlers::* Handler, NativeDelegateType& NativeDelegate, DynamicDelegateType& DynamicDelegate, const ParamTypes&... Params)
+	{
+		if (const HandlerType EventHandler = GetActiveEventHandlers().*Handler)
+		{
+			EventHandler(this, Params...);
+		}
+
+		MounteaInteractionEvents::Broadcast(NativeDelegate, DynamicDelegate, Params...);
+	}
 
 #pragma region InteractableFunctions
 	
@@ -191,28 +335,46 @@ protected:
 	void InteractionStopped_Client(const float& TimeStopped, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor);
 	UFUNCTION(Client, Reliable)
 	void InteractionCancelled_Client(const float& TimeStopped, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor);
-	UFUNCTION(Client, Reliable)
-	void InteractorFound_Client(const TScriptInterface<IMounteaInteractorInterface>& DirtyInteractor);
-	UFUNCTION(Client, Reliable)
-	void InteractorLost_Client(const TScriptInterface<IMounteaInteractorInterface>& DirtyInteractor);
-
-	UFUNCTION(Client, Unreliable)
-	void ProcessToggleActive_Client(const bool bIsEnabled);
-
-	UFUNCTION(Client, Unreliable)
-	void StartHighlight_Client();
-	UFUNCTION(Client, Unreliable)
-	void StopHighlight_Client();
-	UFUNCTION(Client, Unreliable)
-	void ShowWidget_Client();
-	UFUNCTION(Client, Unreliable)
-	void HideWidget_Client();
 
 	UFUNCTION()
 	void OnRep_InteractableState();
 	
 	UFUNCTION()
-	void OnRep_ActiveInteractor();
+	void OnRep_ActiveInteractor(const TScriptInterface<IMounteaInteractorInterface>& OldInteractor);
+
+	UFUNCTION()
+	void OnRep_CosmeticState();
+
+	UFUNCTION()
+	void OnRep_FilterKeySource();
+
+	void InvalidateFilterKey()
+	{ bFilterKeyDirty = true; };
+
+	/** Resolves loaded Ignored Classes and requests async load of the others, which are resolved once loaded. */
+	void ResolveIgnoredClasses();
+	/** Rebuilds Ignored Classes lookup from those already loaded. */
+	void RebuildIgnoredClassesLookup();
+
+	/**
+	 * Updates replicated Cosmetic State on Server.
+	 * Owning Client applies the change in OnRep, Owner without remote connection applies it immediately.
+	 */
+	void SetCosmeticState(const EInteractableCosmeticState Flags, const bool bEnabled);
+	/**
+	 * Sets Active, Highlighted and Widget Visible Cosmetic State at once.
+	 */
+	void SetCosmeticActive(const bool bIsEnabled);
+	/**
+	 * Applies difference between Target State and locally applied Cosmetic State.
+	 * Safe to call repeatedly.
+	 */
+	void ApplyCosmeticState(const uint8 TargetState);
+	/**
+	 * Tells Old Interactor's Connection to release Cosmetic State, unless New Interactor is owned by the same Connection.
+	 * Server only.
+	 */
+	void ReleaseCosmeticStateOf(const TScriptInterface<IMounteaInteractorInterface>& OldInteractor, const TScriptInterface<IMounteaInteractorInterface>& NewInteractor) const;
 
 #pragma endregion
 
@@ -224,10 +386,50 @@ protected:
 	virtual void ProcessShowWidget();
 	virtual void ProcessHideWidget();
 
+	/**
+	 * Flushes Net Dormancy of Owner, so replicated change made in this frame is sent to Clients.
+	 * Does nothing unless Interactable Net Dormancy is enabled in Settings and Owner's Net Dormancy is managed.
+	 * Call it only once a replicated value has actually changed.
+	 *
+	 * @param bSnapshotValue	Whether changed value is carried by Interaction State Manager. Such change keeps Initially Dormant startup Owner untouched.
+	 */
+	void FlushOwnerNetDormancy(const bool bSnapshotValue = false) const;
+	/**
+	 * Puts Owner to DormantAll if all of its Interactables are idle in their Default State without Interactor, otherwise wakes it up.
+	 * Does nothing unless Interactable Net Dormancy is enabled in Settings, Owner is not set to Never and none of its Interactables opted out.
+	 */
+	void UpdateOwnerNetDormancy();
+	/**
+	 * Returns whether this Interactable alone would let its Owner be dormant.
+	 * State of managed Interactables is replicated by Interaction State Manager, other replicated values flush Owner's dormancy once they change.
+	 */
+	bool IsIdleForNetDormancy(const bool bStateManaged) const;
+	/** Updates Net Dormancy of Owning Actor from all of its Interactables, except Excluded one. */
+	static void UpdateNetDormancyOf(AActor* OwningActor, const UMounteaInteractableComponentBase* ExcludedInteractable);
+
+	/**
+	 * Sends current State Snapshot to Interaction State Manager, if there is any.
+	 * Changed Overrides are remembered, so their values are kept in Snapshot from now on.
+	 */
+	void UpdateStateSnapshot(const EMounteaInteractableSnapshotFlags ChangedOverrides = EMounteaInteractableSnapshotFlags::None);
+
+	/**
+	 * Writes state of Interaction Timer to replicated Progress, so all Clients can extrapolate it.
+	 * Call after Interaction Timer is started, paused or cleared on Server.
+	 */
+	void UpdateReplicatedProgress();
+
 	UFUNCTION()
 	virtual void InteractorActionConsumed(UInputAction* ConsumedAction);
+
+	/** Binds to Interactor's Native Input Action Consumed event, if it provides any, otherwise to its Dynamic one. */
+	void BindInteractorActionConsumed(const TScriptInterface<IMounteaInteractorInterface>& InInteractor);
+	void UnbindInteractorActionConsumed(const TScriptInterface<IMounteaInteractorInterface>& InInteractor);
+
 	UFUNCTION()
 	void OnInputModeChanged(ECommonInputType CommonInput);
+	/** Subscribes to Input Method changes of local Player. Deferred until Widget is shown, as no Widget can be updated before. */
+	void BindInputModeChanged();
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Interactable")
 	TSubclassOf<UUserWidget> GetInteractableWidgetClass() const
@@ -477,6 +679,15 @@ protected:
 	
 	virtual void CleanupComponent();
 
+	/** Executes Actions of State transition found in transition table, in their declaration order. */
+	virtual void ProcessStateTransition(const EInteractableStateV2 NewState, const EMounteaInteractableTransitionActions Actions);
+
+	/**
+	 * Queues processing of Dependencies in Dependency Subsystem, so chained Dependencies are processed once per frame.
+	 * Processes them right away if there is no Subsystem or this Interactable has no Dependencies in it.
+	 */
+	void RequestDependencyProcessing();
+
 
 	/**
 	 * Helper function.
@@ -485,6 +696,9 @@ protected:
 	 */
 	UFUNCTION()
 	void AutoSetup();
+
+	/** Returns Auto Setup Template shared by Interactables of the same Owner Class and Setup values. Null if Owner cannot use one. */
+	const FMounteaInteractableSetupTemplate* GetSetupTemplate() const;
 	
 	bool ValidateInteractable() const;
 
@@ -505,6 +719,7 @@ protected:
 	/**
 	 * Event called once Interaction Starts. 
 	 * Called by OnInteractionStarted
+	 * Calling it is deprecated and will be removed, as it skips Native listeners and own handlers.
 	 */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FInteractionStarted OnInteractionStarted;
@@ -512,6 +727,7 @@ protected:
 	/**
 	 * Event called once Interaction Stops.
 	 * Called by OnInteractionStopped
+	 * Calling it is deprecated and will be removed, as it skips Native listeners and own handlers.
 	 */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FInteractionStopped OnInteractionStopped;
@@ -519,6 +735,7 @@ protected:
 	/**
 	 * Event called once Interaction is Canceled.
 	 * Called by OnInteractionCanceled
+	 * Calling it is deprecated and will be removed, as it skips Native listeners and own handlers.
 	 */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FInteractionCanceled OnInteractionCanceled;
@@ -528,6 +745,7 @@ protected:
 	 * This event is the last event in chain.
 	 * Called when Type is Once or after Lifecycles run out.
 	 * Called from OnInteractionCompleted
+	 * Calling it is deprecated and will be removed, as it skips Native listeners and own handlers.
 	 */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FInteractionCompleted OnInteractionCompleted;
@@ -536,6 +754,7 @@ protected:
 	 * Event called once single Interaction Cycle is completed. Provides information which Interactor caused completion.
 	 * Might be called multiple times, before 'OnInteractionCompleted' is called.
 	 * Never called if Type is Once.
+	 * Calling it is deprecated and will be removed, as it skips Native listeners and own handlers.
 	 */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FInteractionCycleCompleted OnInteractionCycleCompleted;
@@ -552,6 +771,7 @@ protected:
 	 * Selected Interactable might differ to this one. In such case, this event calls OnInteractorLost and cancels any interaction which might be in progress.
 	 * Has native C++ implementation.
 	 * Calls OnInteractableSelectedEvent.
+	 * Calling it is deprecated and will be removed, as it skips Native listeners and own handlers.
 	 */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FOnInteractableSelected OnInteractableSelected;
@@ -560,6 +780,7 @@ protected:
 	 * Event called once Interactor is found. Provides info which Interactor is found.
 	 * This event doesn't usually start the interaction, only notifies that this Interactable has found an Interactor.
 	 * Called by OnInteractorFound
+	 * Calling it is deprecated and will be removed, as it skips Native listeners and own handlers.
 	 */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FInteractorFound OnInteractorFound;
@@ -568,6 +789,7 @@ protected:
 	 * Event called once Interactor is lost. Provides info which Interactor is lost.
 	 * This event is usually the first one in chain leading to Interaction Canceled.
 	 * Called by OnInteractorLost.
+	 * Calling it is deprecated and will be removed, as it skips Native listeners and own handlers.
 	 */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FInteractorLost OnInteractorLost;
@@ -626,15 +848,17 @@ protected:
 	/**
 	 * Event called once Ignored Interactor Class is successfully added.
 	 * Called by OnIgnoredInteractorClassAdded.
+	 * Calling it is deprecated and will be removed, as it skips Native listeners and own handlers.
 	 */
-	UPROPERTY(BlueprintAssignable, BlueprintCallable, Category="Mountea|Interaction|Interactable")
+	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactable")
 	FIgnoredInteractorClassAdded OnIgnoredInteractorClassAdded;
 
 	/**
 	 * Event called once Ignored Interactor Class is successfully removed.
 	 * Called by OnIgnoredInteractorClassRemoved.
+	 * Calling it is deprecated and will be removed, as it skips Native listeners and own handlers.
 	 */
-	UPROPERTY(BlueprintAssignable, BlueprintCallable, Category="Mountea|Interaction|Interactor")
+	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FIgnoredInteractorClassRemoved OnIgnoredInteractorClassRemoved;
 
 #pragma endregion 
@@ -816,21 +1040,84 @@ public:
 	virtual FInteractionDeviceChanged& GetInteractionDeviceChangedHandle() override
 	{ return OnInteractionDeviceChanged; };
 
+	virtual void BroadcastInteractableSelected(const TScriptInterface<IMounteaInteractableInterface>& SelectedInteractable) override;
+	virtual void BroadcastInteractorFound(const TScriptInterface<IMounteaInteractorInterface>& FoundInteractor) override;
+	virtual void BroadcastInteractorLost(const TScriptInterface<IMounteaInteractorInterface>& LostInteractor) override;
+	virtual void BroadcastInteractorTraced(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit) override;
+	virtual void BroadcastInteractorOverlapped(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult) override;
+	virtual void BroadcastInteractorStopOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex) override;
+	virtual void BroadcastInteractionStarted(const float& TimeStarted, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor) override;
+	virtual void BroadcastInteractionStopped(const float& TimeStopped, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor) override;
+	virtual void BroadcastInteractableDependencyStarted(const TScriptInterface<IMounteaInteractableInterface>& NewMaster) override;
+	virtual void BroadcastInteractableDependencyStopped(const TScriptInterface<IMounteaInteractableInterface>& FormerMaster) override;
+
 #pragma endregion 
 
 #pragma region Widget
 	
 	/**
 	 * Event called any time any value of 'UserInterfaceSettings' has changed.
+	 * Calling it is deprecated and will be removed, as it skips Native listeners and own handlers.
 	 */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FOnWidgetUpdated OnWidgetUpdated;
 
+	/**
+	 * Calling this event is deprecated and will be removed, as it skips Native listeners and own handlers.
+	 */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FInteractableWidgetVisibilityChanged OnInteractableWidgetVisibilityChanged;
 
 #pragma endregion 
 
+#pragma region NativeEvents
+
+public:
+
+	/**
+	 * Native counterparts of the events above.
+	 * Component's own handlers are bound to these, so dynamic events are broadcast only once Blueprint listener is bound.
+	 */
+	FInteractionStartedNative OnInteractionStartedNative;
+	FInteractionStoppedNative OnInteractionStoppedNative;
+	FInteractionCanceledNative OnInteractionCanceledNative;
+	FInteractionCompletedNative OnInteractionCompletedNative;
+	FInteractionCycleCompletedNative OnInteractionCycleCompletedNative;
+	FLifecycleCompletedNative OnLifecycleCompletedNative;
+	FOnInteractableSelectedNative OnInteractableSelectedNative;
+	FInteractorFoundNative OnInteractorFoundNative;
+	FInteractorLostNative OnInteractorLostNative;
+	FCooldownCompletedNative OnCooldownCompletedNative;
+	FInteractableDependencyChangedNative OnInteractableDependencyChangedNative;
+	FInteractorTracedNative OnInteractorTracedNative;
+	FInteractorOverlappedNative OnInteractorOverlappedNative;
+	FInteractorStopOverlapNative OnInteractorStopOverlapNative;
+	FIgnoredInteractorClassAddedNative OnIgnoredInteractorClassAddedNative;
+	FIgnoredInteractorClassRemovedNative OnIgnoredInteractorClassRemovedNative;
+	FHighlightableComponentAddedNative OnHighlightableComponentAddedNative;
+	FHighlightableComponentRemovedNative OnHighlightableComponentRemovedNative;
+	FCollisionComponentAddedNative OnCollisionComponentAddedNative;
+	FCollisionComponentRemovedNative OnCollisionComponentRemovedNative;
+	FInteractableAutoSetupChangedNative OnInteractableAutoSetupChangedNative;
+	FInteractableWeightChangedNative OnInteractableWeightChangedNative;
+	FInteractableStateChangedNative OnInteractableStateChangedNative;
+	FInteractableOwnerChangedNative OnInteractableOwnerChangedNative;
+	FInteractableCollisionChannelChangedNative OnInteractableCollisionChannelChangedNative;
+	FLifecycleModeChangedNative OnLifecycleModeChangedNative;
+	FLifecycleCountChangedNative OnLifecycleCountChangedNative;
+	FCooldownPeriodChangedNative OnCooldownPeriodChangedNative;
+	FInteractorChangedNative OnInteractorChangedNative;
+	FHighlightTypeChangedNative OnHighlightTypeChangedNative;
+	FHighlightMaterialChangedNative OnHighlightMaterialChangedNative;
+	FInputActionConsumedNative OnInputActionConsumedNative;
+	FInteractionDeviceChangedNative OnInteractionDeviceChangedNative;
+	FInteractableDependencyStartedNative InteractableDependencyStartedNative;
+	FInteractableDependencyStoppedNative InteractableDependencyStoppedNative;
+	FOnWidgetUpdatedNative OnWidgetUpdatedNative;
+	FInteractableWidgetVisibilityChangedNative OnInteractableWidgetVisibilityChangedNative;
+
+#pragma endregion 
+
 #pragma endregion 
 
 #pragma region Attributes
@@ -888,7 +1175,7 @@ protected:
 	 *
 	 * Could be either Trace or Object response.
 	 */
-	UPROPERTY(Replicated, SaveGame, EditAnywhere, Category="MounteaInteraction|Required", meta=(NoResetToDefault))
+	UPROPERTY(ReplicatedUsing=OnRep_FilterKeySource, SaveGame, EditAnywhere, Category="MounteaInteraction|Required", meta=(NoResetToDefault))
 	TEnumAsByte<ECollisionChannel>																	CollisionChannel;
 	
 	/**
@@ -943,7 +1230,7 @@ protected:
 	/**
 	 * 
 	 */
-	UPROPERTY(Replicated, EditAnywhere, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
+	UPROPERTY(ReplicatedUsing=OnRep_FilterKeySource, EditAnywhere, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
 	FGameplayTagContainer																					InteractableCompatibleTags;
 	
 	/**
@@ -1002,8 +1289,31 @@ protected:
 	UPROPERTY(Replicated, SaveGame, EditAnywhere, BlueprintReadOnly,  Category="MounteaInteraction|Optional", meta=(EditCondition="bInteractionHighlight==true"))
 	TObjectPtr<UMaterialInterface>																		HighlightMaterial = nullptr;
 
+	/**
+	 * Parameters applied to Highlight Material.
+	 * Interactables using the same Material with the same Parameters share one Material Instance.
+	 * Local only, not replicated. Highlight is cosmetic, so the value set up in Editor is used on every machine.
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly,  Category="MounteaInteraction|Optional", meta=(EditCondition="bInteractionHighlight==true && HighlightType==EHighlightType::EHT_OverlayMaterial"))
+	FMounteaHighlightMaterialParameters																HighlightMaterialParameters;
+
+	/**
+	 * Name of scalar Highlight Material parameter which is driven by Interaction Progress.
+	 * Progress is updated centrally by Highlight Subsystem. Leave empty to disable.
+	 * Local only, not replicated, like Highlight Material Parameters.
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly,  Category="MounteaInteraction|Optional", meta=(EditCondition="bInteractionHighlight==true && HighlightType==EHighlightType::EHT_OverlayMaterial"))
+	FName																												HighlightProgressParameterName = NAME_None;
+
 	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly,  Category="MounteaInteraction|Optional")
 	uint8																												bCanPersist : 1;
+
+	/**
+	 * Whether this Interactable manages Net Dormancy of its Owner once it is enabled in Settings.
+	 * Disable for Owners which replicate state of their own and must stay awake. Any Interactable opting out keeps whole Owner unmanaged.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly,  Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
+	uint8																												bManageOwnerNetDormancy : 1;
 	
 	/**
 	 * Provides a simple way to determine how fast Interaction Progress is kept before interaction is cancelled.
@@ -1108,6 +1418,14 @@ protected:
 	
 	UPROPERTY()
 	FTimerHandle																									Timer_Interaction;
+
+	/**
+	 * Interaction Progress replicated to all Clients.
+	 * Clients extrapolate running progress from Server World time.
+	 */
+	UPROPERTY(Replicated, VisibleAnywhere, Category="MounteaInteraction|Read Only")
+	FMounteaReplicatedProgress																				ReplicatedProgress;
+	
 	UPROPERTY()
 	FTimerHandle																									Timer_Cooldown;
 	UPROPERTY()
@@ -1123,6 +1441,53 @@ private:
 
 	UPROPERTY(VisibleAnywhere, Category="MounteaInteraction|Read Only", meta=(NoResetToDefault))
 	uint8 bInteractableInitialized : 1;
+
+	/** Whether this Interactable has put its Owner to Net Dormancy. */
+	uint8 bOwnerNetDormant : 1;
+
+	/** Whether Interactor Found has been broadcast on this Client from replicated Interactor. */
+	uint8 bInteractorFoundBroadcast : 1;
+
+	/**
+	 * Presentation state replicated to owning Client.
+	 * Bitmask of EInteractableCosmeticState.
+	 */
+	UPROPERTY(ReplicatedUsing=OnRep_CosmeticState, VisibleAnywhere, Category="MounteaInteraction|Read Only", meta=(Bitmask, BitmaskEnum="/Script/MounteaInteractionSystem.EInteractableCosmeticState"))
+	uint8 CosmeticState;
+
+	/** Cosmetic State which has been applied locally. */
+	uint8 AppliedCosmeticState;
+
+	/**
+	 * Values changed at runtime which are always part of State Snapshot.
+	 * Bitmask of EMounteaInteractableSnapshotFlags.
+	 */
+	uint8 StateSnapshotOverrides;
+
+	/** Whether Snapshot has been received before BeginPlay. */
+	uint8 bHasPendingStateSnapshot : 1;
+
+	FMounteaInteractableStateSnapshot PendingStateSnapshot;
+
+	/** Cached Handle of this Interactable. */
+	mutable FMounteaInteractableHandle InteractableHandle;
+
+	/** Bitmask of EMounteaInteractableNativeFunction not overridden in Blueprint. */
+	uint32 NativeDispatchFunctions = 0;
+
+	/** Filter Key compiled from Collision Channel and Compatible Tags. */
+	mutable FMounteaInteractionFilterKey FilterKey;
+	mutable bool bFilterKeyDirty = true;
+
+	/** Whether Class is ignored, seeded with loaded Ignored Classes and their subclasses, filled on lookup for the others. */
+	mutable TMap<TObjectKey<UClass>, bool> IgnoredClassesLookup;
+	TSharedPtr<FStreamableHandle> IgnoredClassesLoadHandle;
+
+	/** Own event handlers of this instance, replacing Class ones when set. */
+	TUniquePtr<FMounteaInteractableEventHandlers> InstanceEventHandlers;
+
+	/** Whether OnInputModeChanged is subscribed to Common Input Subsystem. */
+	uint8 bInputModeChangedBound : 1;
 	
 #pragma endregion
 
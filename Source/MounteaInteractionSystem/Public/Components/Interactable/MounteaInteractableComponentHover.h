@@ -10,6 +10,9 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCursorBeginsOverlap, UPrimitiveComponent*, PrimitiveComponent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCursorStopsOverlap, UPrimitiveComponent*, PrimitiveComponent);
 
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnCursorBeginsOverlapNative, UPrimitiveComponent*);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnCursorStopsOverlapNative, UPrimitiveComponent*);
+
 UCLASS(ClassGroup=(Mountea), meta=(BlueprintSpawnableComponent, DisplayName = "Interactable Component Hover"))
 class MOUNTEAINTERACTIONSYSTEM_API UMounteaInteractableComponentHover : public UMounteaInteractableComponentHold
 {
@@ -20,7 +23,7 @@ public:
 	UMounteaInteractableComponentHover();
 
 protected:
-	virtual void BeginPlay() override;
+	virtual const FMounteaInteractableEventHandlers& GetEventHandlers() const override;
 
 	virtual void BindCollisionShape_Implementation(UPrimitiveComponent* PrimitiveComponent) const override;
 	virtual void UnbindCollisionShape_Implementation(UPrimitiveComponent* PrimitiveComponent) const override;
@@ -46,6 +49,15 @@ protected:
 	UPROPERTY(BlueprintAssignable, Category="Mountea|Interaction|Interactable")
 	FOnCursorStopsOverlap OnCursorStopsOverlap;
 
+public:
+
+	/**
+	 * Native counterparts of the events above.
+	 * Dynamic events are broadcast only once Blueprint listener is bound.
+	 */
+	FOnCursorBeginsOverlapNative OnCursorBeginsOverlapNative;
+	FOnCursorStopsOverlapNative OnCursorStopsOverlapNative;
+
 protected:
 
 	UPROPERTY(SaveGame, VisibleAnywhere, Category="MounteaInteraction|Read Only")
@@ -8,6 +8,8 @@
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnInteractionFailed);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnKeyMashed);
+DECLARE_MULTICAST_DELEGATE(FOnInteractionFailedNative);
+DECLARE_MULTICAST_DELEGATE(FOnKeyMashedNative);
 
 /**
  * Actor Interactable Mash Component
@@ -32,7 +34,6 @@ public:
 
 protected:
 	
-	virtual void BeginPlay() override;
 	virtual void InteractionStarted_Implementation(const float& TimeStarted, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor) override;
 	virtual void InteractionStopped_Implementation(const float& TimeStarted, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor) override;
 	virtual void InteractionCanceled_Implementation() override;
@@ -112,4 +113,9 @@ protected:
 	 */
 	UPROPERTY(BlueprintAssignable, Category="Mountea|Interaction|Interactable")
 	FOnKeyMashed OnKeyMashed;
+
+public:
+
+	FOnInteractionFailedNative OnInteractionFailedNative;
+	FOnKeyMashedNative OnKeyMashedNative;
 };
\ No newline at end of file
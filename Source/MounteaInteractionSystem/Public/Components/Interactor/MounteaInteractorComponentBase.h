@@ -4,13 +4,20 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Helpers/MounteaInteractionFilterKey.h"
+#include "Helpers/MounteaInteractionHandles.h"
 #include "Helpers/MounteaInteractionHelpers.h"
+#include "Helpers/MounteaInteractionNativeDispatch.h"
+#include "Helpers/MounteaInteractionStateMachine.h"
+#include "Helpers/MounteaInteractorDependencyList.h"
 #include "Interfaces/MounteaInteractorInterface.h"
 #include "MounteaInteractorComponentBase.generated.h"
 
 class UInputAction;
 struct FDebugSettings;
 class UInputMappingContext;
+class UMeshComponent;
+class UMounteaInteractableComponentBase;
 
 /**
  * Actor Interactor Base Component
@@ -29,9 +36,37 @@ public:
 
 	UMounteaInteractorComponentBase();
 
+	/**
+	 * Returns Handle of this Interactor.
+	 * Handle is acquired on first use and released in EndPlay.
+	 */
+	FMounteaInteractorHandle GetInteractorHandle() const;
+
+	/**
+	 * Returns Handle of Active Interactable stored by this Component.
+	 * Native alternative to GetActiveInteractable, which avoids Blueprint dispatch.
+	 */
+	FMounteaInteractableHandle GetActiveInteractableHandle() const
+	{ return ActiveInteractableHandle; };
+
+	/**
+	 * Returns whether Function can be called directly instead of through Execute_ thunk.
+	 * Resolved once this Component begins play, false before.
+	 */
+	bool CanDispatchNatively(const EMounteaInteractorNativeFunction Function) const
+	{ return (NativeDispatchFunctions & (1u << static_cast<uint8>(Function))) != 0; };
+
+	/**
+	 * Returns Filter Key compiled from Response Channel and Interactor Tag.
+	 * Compiled on first use after either of them changes.
+	 */
+	const FMounteaInteractionFilterKey& GetFilterKey() const;
+
 protected:
 	
+	virtual void PostInitProperties() override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 #pragma region Handles
 
@@ -53,6 +88,8 @@ public:
 	{ return OnInputActionConsumed; };
 	virtual FStateChanged& GetOnStateChangedHandle() override
 	{ return OnStateChanged; };
+	virtual FInputActionConsumedNative* GetInputActionConsumedNativeHandle() override
+	{ return &OnInputActionConsumedNative; };
 
 #pragma endregion
 	
@@ -145,7 +182,7 @@ protected:
 	void SetDefaultState_Server(const EInteractorStateV2 NewState);
 
 	UFUNCTION(Server, Reliable)
-	void SetActiveInteractable_Server(const TScriptInterface<IMounteaInteractableInterface>& NewInteractable);
+	void SetActiveInteractable_Server(const FMounteaInteractableHandle& NewInteractable);
 
 	UFUNCTION(Server, Reliable)
 	void SetInteractorTag_Server(const FGameplayTag& NewInteractorTag);
@@ -154,7 +191,11 @@ protected:
 	void SetSafetyTracingSetup_Server(const FSafetyTracingSetup& NewSafetyTracingSetup);
 
 	UFUNCTION(Client, Reliable)
-	void SetActiveInteractable_Client(const TScriptInterface<IMounteaInteractableInterface>& NewInteractable);
+	void SetActiveInteractable_Client(const FMounteaInteractableHandle& NewInteractable);
+
+	/** Sent by Interactable once this Interactor stops owning it, so its Cosmetic State is released locally. */
+	UFUNCTION(Client, Reliable)
+	void ReleaseInteractableCosmetics_Client(const FMounteaInteractableHandle& Interactable);
 
 	UFUNCTION()
 	void OnRep_InteractorState();
@@ -162,10 +203,54 @@ protected:
 	UFUNCTION()
 	void OnRep_ActiveInteractable();
 
+	UFUNCTION()
+	void OnRep_FilterKeySource();
+
 	virtual void ProcessStateChanged();
 	virtual void ProcessStateChanged_Client();
 
+	/** Executes Actions of State transition found in transition table, in their declaration order. */
+	virtual void ProcessStateTransition(const EInteractorStateV2 NewState, const EMounteaInteractorTransitionActions Actions);
+
 	virtual void ProcessInteractableChanged();
+
+	/**
+	 * Returns whether Server RPC of given type from owning Connection fits its budget.
+	 * Must be called first in Server RPC implementation, so dropped calls do no work.
+	 *
+	 * Only requests which start something may be dropped. RPCs which stop Interaction, change State or configuration
+	 * go through CoalesceServerRPC instead, as Client would otherwise stay out of sync with Server.
+	 * Min Tokens Per Second raises the configured budget, for RPCs whose legitimate rate depends on the Interactor.
+	 */
+	bool ConsumeServerRPCToken(const EMounteaServerRPCType RPCType, const float MinTokensPerSecond = 0.f) const;
+
+	/**
+	 * Applies Request right away if it fits budget of RPC Type, otherwise keeps it until budget refills.
+	 * Pending Request is replaced by any newer Request of the same Key, so only the latest value is applied.
+	 */
+	void CoalesceServerRPC(const EMounteaServerRPCType RPCType, const FName& RequestKey, TFunction<void()>&& Request);
+	/** Discards pending Request of given Key, if any. */
+	void CancelPendingServerRPC(const FName& RequestKey);
+
+	/**
+	 * Called once Dependency is added to List of Dependencies.
+	 * Called on Server directly and on Clients per replicated item.
+	 */
+	virtual void ProcessDependencyAdded(const TScriptInterface<IMounteaInteractorInterface>& AddedDependency);
+	/**
+	 * Called once Dependency is removed from List of Dependencies.
+	 * Called on Server directly and on Clients per replicated item.
+	 */
+	virtual void ProcessDependencyRemoved(const TScriptInterface<IMounteaInteractorInterface>& RemovedDependency);
+
+	/**
+	 * Queues processing of Dependencies in Dependency Subsystem, so chained Dependencies are processed once per frame.
+	 * Processes them right away if there is no Subsystem or this Interactor has no Dependencies in it.
+	 */
+	void RequestDependencyProcessing();
+	
+	friend FMounteaInteractorDependencyItem;
+	friend UMounteaInteractableComponentBase;
 	
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
@@ -180,6 +265,7 @@ public:
 	 * Example:
 	 * Interactor overlaps with a chest of drawers. There are multiple interactables for each drawer and for items within them.
 	 * However, drawers have higher weight, thus always suppress items, unless specified otherwise.
+	 * Calling it is deprecated and will be removed, as it skips Native listeners and own handlers.
 	 */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FInteractableSelected			OnInteractableUpdated;
@@ -187,24 +273,28 @@ public:
 	/**
 	 * This event is called once this Interactor finds any Interactable.
 	 * This event might happen for multiple Interactables. Each one is compared and if fit it is fed to OnInteractableSelected.
+	 * Calling it is deprecated and will be removed, as it skips Native listeners and own handlers.
 	 */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FInteractableFound				OnInteractableFound;
 	
 	/**
 	 * This event is called one this Interactor loose its Active Interactable.
+	 * Calling it is deprecated and will be removed, as it skips Native listeners and own handlers.
 	 */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FInteractableLost				OnInteractableLost;
 	
 	/**
 	 * This event should be called once starting the Interaction Action is requested and valid Key is pressed.
+	 * Component's own handler is bound to this event directly, so it can be called from anywhere.
 	 */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FInteractionKeyPressed		OnInteractionKeyPressed;
 	
 	/**
 	 * This event should be called once stopping the Interaction Action is requested and valid Key is released.
+	 * Component's own handler is bound to this event directly, so it can be called from anywhere.
 	 */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FInteractionKeyReleased	OnInteractionKeyReleased;
@@ -254,8 +344,46 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FInteractorTagChanged		OnInteractorTagChanged;
 
-	UPROPERTY(BlueprintAssignable, BlueprintCallable, Category="Mountea|Interaction|Interactor")
+	/**
+	 * This event is called once ConsumeInput is requested.
+	 * Use ConsumeInput to raise it, so Native listeners are notified as well.
+	 * Calling it is deprecated and will be removed, as it skips Native listeners and own handlers.
+	 */
+	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FInputActionConsumed		OnInputActionConsumed;
+
+	/**
+	 * This event is called once Interaction Dependency is added.
+	 * Called on Server and on every Client once the item replicates.
+	 */
+	UPROPERTY(BlueprintAssignable, Category="Mountea|Interaction|Interactor")
+	FInteractionDependencyAdded		OnInteractionDependencyAdded;
+
+	/**
+	 * This event is called once Interaction Dependency is removed.
+	 * Called on Server and on every Client once the item replicates.
+	 */
+	UPROPERTY(BlueprintAssignable, Category="Mountea|Interaction|Interactor")
+	FInteractionDependencyRemoved	OnInteractionDependencyRemoved;
+
+	/**
+	 * Native counterparts of the events above.
+	 * Component's own handlers are bound to these, so dynamic events are broadcast only once Blueprint listener is bound.
+	 * Calling events with Native counterparts directly is therefore deprecated, they are raised by the Component.
+	 */
+	FInteractableSelectedNative		OnInteractableUpdatedNative;
+	FInteractableFoundNative		OnInteractableFoundNative;
+	FInteractableLostNative		OnInteractableLostNative;
+	FStateChangedNative		OnStateChangedNative;
+	FStateChangedNative		OnStateChanged_ClientNative;
+	FCollisionChangedNative		OnCollisionChangedNative;
+	FAutoActivateChangedNative		OnAutoActivateChangedNative;
+	FIgnoredActorAddedNative		OnIgnoredActorAddedNative;
+	FIgnoredActorRemovedNative		OnIgnoredActorRemovedNative;
+	FInteractorTagChangedNative		OnInteractorTagChangedNative;
+	FInputActionConsumedNative		OnInputActionConsumedNative;
+	FInteractionDependencyAddedNative		OnInteractionDependencyAddedNative;
+	FInteractionDependencyRemovedNative		OnInteractionDependencyRemovedNative;
 	
 protected:
 	
@@ -263,7 +391,7 @@ protected:
 	 * Gameplay Tag which helps further filter out Interaction.
 	 * Requires match in Interactable's `Interactable Tags` container.
 	 */
-	UPROPERTY(Replicated, EditAnywhere, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
+	UPROPERTY(ReplicatedUsing=OnRep_FilterKeySource, EditAnywhere, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
 	FGameplayTag											InteractorTag;
 
 	/**
@@ -283,7 +411,7 @@ protected:
 	 * * Interaction Hover
 	 * * etc.
 	 */
-	UPROPERTY(Replicated, EditAnywhere, Category="MounteaInteraction|Required", meta=(NoResetToDefault))
+	UPROPERTY(ReplicatedUsing=OnRep_FilterKeySource, EditAnywhere, Category="MounteaInteraction|Required", meta=(NoResetToDefault))
 	TEnumAsByte<ECollisionChannel>				CollisionChannel;
 	
 	/**
@@ -320,10 +448,61 @@ private:
 	// This is Interactable which is set as Active
 	UPROPERTY(ReplicatedUsing=OnRep_ActiveInteractable, VisibleAnywhere, Category="MounteaInteraction|Read Only")
 	TScriptInterface<IMounteaInteractableInterface> ActiveInteractable;
+
+	// Handle of Active Interactable, kept in sync on Server and in OnRep
+	FMounteaInteractableHandle ActiveInteractableHandle;
+
+	// Cached Handle of this Interactor
+	mutable FMounteaInteractorHandle InteractorHandle;
+
+	// Bitmask of EMounteaInteractorNativeFunction not overridden in Blueprint
+	uint32 NativeDispatchFunctions = 0;
+
+	// Filter Key compiled from Response Channel and Interactor Tag
+	mutable FMounteaInteractionFilterKey FilterKey;
+	mutable bool bFilterKeyDirty = true;
+
+	/**
+	 * Origin of Safety Trace in Socket mode.
+	 * Resolved once Safety Trace Setup, Owner Components or Mesh asset change.
+	 */
+	struct FSafetyTraceOrigin
+	{
+		FName								MeshName;
+		FName								SocketName;
+		int32								NumOwnerComponents = 0;
+		bool								bResolved = false;
+		
+		TWeakObjectPtr<UMeshComponent>	Mesh;
+		TWeakObjectPtr<const UObject>		MeshAsset;
+		/** Bone the Socket is attached to. INDEX_NONE if Socket Location is relative to the Mesh. */
+		int32								BoneIndex = INDEX_NONE;
+		FVector							SocketLocation = FVector::ZeroVector;
+	};
+
+	FSafetyTraceOrigin SafetyTraceOrigin;
+
+	void ResolveSafetyTraceOrigin();
+	/** Returns false if Socket of Safety Trace Setup cannot be found. */
+	bool GetSafetyTraceSocketLocation(FVector& OutLocation);
 	
 	// List of interactors suppressed by this one
 	UPROPERTY(Replicated, VisibleAnywhere, Category="MounteaInteraction|Read Only")
-	TArray<TScriptInterface<IMounteaInteractorInterface>> InteractionDependencies;
+	FMounteaInteractorDependencyList InteractionDependencies;
+
+	/** Server RPC Request waiting for budget of its type. */
+	struct FPendingServerRPC
+	{
+		EMounteaServerRPCType		RPCType = EMounteaServerRPCType::Default;
+		TFunction<void()>				Request;
+	};
+
+	// Latest pending Request of each Key, applied once budget refills
+	TMap<FName, FPendingServerRPC> PendingServerRPCs;
+	FTimerHandle PendingServerRPCsTimerHandle;
+
+	void FlushPendingServerRPCs();
+	void SchedulePendingServerRPCs();
 
 #pragma region Editor
 
@@ -10,6 +10,9 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCollisionShapeAdded, UPrimitiveComponent*, AddedComponent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCollisionShapeRemoved, UPrimitiveComponent*, RemovedComponent);
 
+DECLARE_MULTICAST_DELEGATE_OneParam(FCollisionShapeAddedNative, UPrimitiveComponent*);
+DECLARE_MULTICAST_DELEGATE_OneParam(FCollisionShapeRemovedNative, UPrimitiveComponent*);
+
 /**
  * 
  */
@@ -131,6 +134,13 @@ public:
 
 	UPROPERTY(BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FCollisionShapeRemoved																	OnCollisionShapeRemoved;
+
+	/**
+	 * Native counterparts of the events above.
+	 * Dynamic events are broadcast only once Blueprint listener is bound.
+	 */
+	FCollisionShapeAddedNative																OnCollisionShapeAddedNative;
+	FCollisionShapeRemovedNative															OnCollisionShapeRemovedNative;
 	
 protected:
 
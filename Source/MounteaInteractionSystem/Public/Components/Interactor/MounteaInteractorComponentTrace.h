@@ -8,6 +8,8 @@
 #include "Engine/HitResult.h"
 #include "MounteaInteractorComponentTrace.generated.h"
 
+class USceneComponent;
+
 /**
  * 
  */
@@ -53,6 +55,22 @@ struct FInteractionTraceDataV2
 };
 
 #pragma region TracingData
+/**
+ * Defines which values of Tracing Data have been changed.
+ */
+enum class EMounteaTracingDataFields : uint8
+{
+	None					= 0,
+	Type					= 1 << 0,
+	Interval				= 1 << 1,
+	Range					= 1 << 2,
+	ShapeHalfSize		= 1 << 3,
+	CustomStart			= 1 << 4,
+
+	All						= Type | Interval | Range | ShapeHalfSize | CustomStart
+};
+ENUM_CLASS_FLAGS(EMounteaTracingDataFields)
+
 USTRUCT(BlueprintType)
 struct FTracingData
 {
@@ -96,6 +114,36 @@ struct FTracingData
 		TracingShapeHalfSize = FMath::Max(0.1f, NewShapeHalfSize);
 	}
 
+	/**
+	 * Clamps values to their allowed ranges.
+	 */
+	void Validate()
+	{
+		TracingInterval = FMath::Max(0.01f, TracingInterval);
+		TracingRange = FMath::Max(1.f, TracingRange);
+		TracingShapeHalfSize = FMath::Max(0.1f, TracingShapeHalfSize);
+	}
+
+	/**
+	 * Copies only given Fields from Source.
+	 */
+	void CopyFields(const FTracingData& Source, const EMounteaTracingDataFields Fields)
+	{
+		if (EnumHasAnyFlags(Fields, EMounteaTracingDataFields::Type))
+			TracingType = Source.TracingType;
+		if (EnumHasAnyFlags(Fields, EMounteaTracingDataFields::Interval))
+			TracingInterval = Source.TracingInterval;
+		if (EnumHasAnyFlags(Fields, EMounteaTracingDataFields::Range))
+			TracingRange = Source.TracingRange;
+		if (EnumHasAnyFlags(Fields, EMounteaTracingDataFields::ShapeHalfSize))
+			TracingShapeHalfSize = Source.TracingShapeHalfSize;
+		if (EnumHasAnyFlags(Fields, EMounteaTracingDataFields::CustomStart))
+		{
+			bUsingCustomStartTransform = Source.bUsingCustomStartTransform;
+			CustomTracingTransform = Source.CustomTracingTransform;
+		}
+	}
+
 	inline bool operator==(const FTracingData& Other) const
 	{
 		return
@@ -104,7 +152,7 @@ struct FTracingData
 		FMath::IsNearlyEqual(TracingRange, Other.TracingRange) &&
 		FMath::IsNearlyEqual(TracingShapeHalfSize, Other.TracingShapeHalfSize) &&
 		bUsingCustomStartTransform == Other.bUsingCustomStartTransform &&
-		(bUsingCustomStartTransform && CustomTracingTransform.Equals(Other.CustomTracingTransform))
+		(!bUsingCustomStartTransform || CustomTracingTransform.Equals(Other.CustomTracingTransform))
 		;
 	}
 
@@ -118,6 +166,9 @@ struct FTracingData
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FTracingDataChanged, const FTracingData&, NewTracingData, const FTracingData&, OldTracingData);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnTraced);
 
+DECLARE_MULTICAST_DELEGATE_TwoParams(FTracingDataChangedNative, const FTracingData&, const FTracingData&);
+DECLARE_MULTICAST_DELEGATE(FOnTracedNative);
+
 /**
  * 
  */
@@ -260,6 +311,8 @@ public:
 
 	/**
 	 * Sets Trace Start to specified location.
+	 * On Clients the value is sent to Server quantized and rate limited by Trace Origin Send Interval.
+	 * Ignored if Trace Origin Component is set.
 	 *
 	 * @param TraceStart	Value to be used as Custom Trace Start.
 	 */
@@ -269,10 +322,101 @@ public:
 	
 	/**
 	 * Returns current Custom Trace Start value.
+	 * If Trace Origin Component is set, its Socket transform is returned.
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Interactor")
 	virtual FTransform GetCustomTraceStart() const;
 
+	/**
+	 * Sets Component, and optionally its Socket, the Trace starts from when using Custom Start Transform.
+	 * Both Server and Client resolve the transform locally, so no transform is sent over network.
+	 * Pass null Component to use Custom Trace Start instead.
+	 *
+	 * @param NewOriginComponent	Component to trace from, like Weapon Mesh.
+	 * @param NewOriginSocketName	Optional Socket of the Component, like Barrel.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="MounteaInteraction|Tracing")
+	void SetTraceOriginComponent(USceneComponent* NewOriginComponent, const FName& NewOriginSocketName);
+	virtual void SetTraceOriginComponent_Implementation(USceneComponent* NewOriginComponent, const FName& NewOriginSocketName);
+
+	/**
+	 * Returns Component the Trace starts from. Null if Custom Trace Start is used.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Interactor")
+	virtual USceneComponent* GetTraceOriginComponent() const
+	{ return TraceOriginComponent; };
+
+	/**
+	 * Validates and applies all Tracing Data at once.
+	 * Results in a single Server request and a single OnTraceDataChanged event.
+	 *
+	 * Individual Setters called within one frame are collected and applied using this function at the start of next frame.
+	 *
+	 * @param NewTracingData	Tracing Data to be applied.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="MounteaInteraction|Tracing")
+	void ApplyTracingData(const FTracingData& NewTracingData);
+	virtual void ApplyTracingData_Implementation(const FTracingData& NewTracingData);
+
+protected:
+
+	/**
+	 * Returns Tracing Data built from current values, including changes waiting to be applied.
+	 */
+	FTracingData GetPendingTracingData() const;
+
+	/**
+	 * Stores Tracing Data to be applied at the start of next frame.
+	 * On Server values are written immediately, only the change event is deferred.
+	 * Client sends only Changed Fields, so values changed by Server meanwhile are not overwritten.
+	 */
+	void QueueTracingData(const FTracingData& NewTracingData, const EMounteaTracingDataFields ChangedFields);
+
+	void FlushTracingData();
+
+	/**
+	 * Writes Tracing Data to replicated values.
+	 */
+	void WriteTracingData(const FTracingData& NewTracingData);
+
+	/**
+	 * Writes Custom Trace Start and updates Safety Trace start accordingly.
+	 */
+	void WriteTraceOrigin(const FTransform& TraceStart);
+
+	/**
+	 * Sends latest Custom Trace Start to Server, unless Server already has the same quantized value.
+	 * First value is sent reliably, following ones unreliably.
+	 */
+	void SendTraceOrigin();
+
+	/**
+	 * Sends last Custom Trace Start reliably once it stopped changing.
+	 * Unreliable updates may be lost or arrive before Server enables Custom Trace Start, this corrects them.
+	 */
+	void SendSettledTraceOrigin();
+
+	/** Returns how often Custom Trace Start is sent to Server. */
+	float GetTraceOriginSendInterval() const
+	{ return TraceOriginSendInterval > 0.f ? TraceOriginSendInterval : TraceInterval; };
+
+	/**
+	 * Writes settled Custom Trace Start and notifies about changed Tracing Data.
+	 * Streamed values are only written, so listeners are not notified with every update.
+	 */
+	void CommitTraceOrigin(const FTransform& TraceStart);
+
+	/** Commits Custom Trace Start set on Server once it stopped changing. */
+	void CommitSettledTraceOrigin();
+
+	/**
+	 * Unpacks Custom Trace Start received from Client.
+	 * Only settled value is committed to Tracing Data.
+	 */
+	void ReceiveTraceOrigin(const FVector_NetQuantize10& TraceStartLocation, const uint32 PackedTraceStartRotation, const bool bSettled);
+
+	/** Returns how many Trace Server RPCs per second this Interactor legitimately sends. */
+	float GetTraceRPCRate() const;
 protected:
 	
 	/**
@@ -308,23 +452,23 @@ protected:
 	UFUNCTION(Server, Reliable)
 	void ProcessTrace_Server();
 
-	UFUNCTION(Server, Unreliable)
-	void SetTraceType_Server(const EMounteaTraceType& NewTraceType);
-
-	UFUNCTION(Server, Unreliable)
-	void SetTraceInterval_Server(float NewInterval);
-
-	UFUNCTION(Server, Unreliable)
-	void SetTraceRange_Server(float NewRange);
+	UFUNCTION(Server, Reliable)
+	void ApplyTracingData_Server(const FTracingData& NewTracingData, const uint8 ChangedFields);
 
+	/**
+	 * Location is quantized to 0.1cm, Pitch and Yaw are packed to 16 bits each.
+	 */
 	UFUNCTION(Server, Unreliable)
-	void SetTraceShapeHalfSize_Server(float NewTraceShapeHalfSize);
+	void SetCustomTraceStart_Server(const FVector_NetQuantize10& TraceStartLocation, const uint32 PackedTraceStartRotation);
 
-	UFUNCTION(Server, Unreliable)
-	void SetUseCustomStartTransform_Server(bool bUse);
+	/**
+	 * Reliable counterpart of SetCustomTraceStart_Server, ordered after ApplyTracingData_Server.
+	 */
+	UFUNCTION(Server, Reliable)
+	void SetSettledCustomTraceStart_Server(const FVector_NetQuantize10& TraceStartLocation, const uint32 PackedTraceStartRotation);
 
-	UFUNCTION(Server, Unreliable)
-	void SetCustomTraceStart_Server(const FTransform& TraceStart);
+	UFUNCTION(Server, Reliable)
+	void SetTraceOriginComponent_Server(USceneComponent* NewOriginComponent, const FName& NewOriginSocketName);
 
 	UFUNCTION(Client, Unreliable)
 	void PostTraced_Client();
@@ -390,16 +534,52 @@ protected:
 	 * Defines where does the Tracing start and what direction it follows.
 	 * Will be ignored if bUseCustomStartTransform is false.
 	 */
-	UPROPERTY(Replicated, VisibleAnywhere, Category="MounteaInteraction|Read Only", AdvancedDisplay, meta=(DisplayName="Trace Start (World Space Transform)"))
+	UPROPERTY(VisibleAnywhere, Category="MounteaInteraction|Read Only", AdvancedDisplay, meta=(DisplayName="Trace Start (World Space Transform)"))
 	FTransform																		CustomTraceTransform;
 
+	/**
+	 * Component the Tracing starts from when bUseCustomStartTransform is true.
+	 * Takes priority over Custom Trace Start, as it is resolved locally on both sides.
+	 */
+	UPROPERTY(Replicated, VisibleAnywhere, Category="MounteaInteraction|Read Only", AdvancedDisplay)
+	TObjectPtr<USceneComponent>												TraceOriginComponent;
+
+	/**
+	 * Optional Socket of Trace Origin Component.
+	 */
+	UPROPERTY(Replicated, EditAnywhere, Category="MounteaInteraction|Optional", meta=(EditCondition="bUseCustomStartTransform"))
+	FName																			TraceOriginSocketName;
+
+	/**
+	 * How often Clients send Custom Trace Start to Server, in seconds.
+	 * If 0, Trace Interval is used, as Server reads the value only when tracing.
+	 */
+	UPROPERTY(EditAnywhere, Category="MounteaInteraction|Optional", meta=(Units = "s", UIMin=0.f, ClampMin=0.f, EditCondition="bUseCustomStartTransform"))
+	float																				TraceOriginSendInterval;
+
 	/**
 	 * Structure of all Tracing Data at one place.
-	 * Updated every time any value is changed.
+	 * Updated every time any value is changed, Custom Trace Start only once it settles.
 	 */
 	UPROPERTY(Transient, VisibleAnywhere, Category="MounteaInteraction|Read Only")
 	FTracingData																	LastTracingData;
 
+	/**
+	 * Tracing Data collected from Setters within this frame.
+	 * Valid only while bTracingDataFlushPending is true.
+	 */
+	UPROPERTY(Transient)
+	FTracingData																	PendingTracingData;
+
+	uint8																				bTracingDataFlushPending : 1;
+
+	/** Fields of Pending Tracing Data changed by Setters. */
+	EMounteaTracingDataFields													PendingTracingDataFields;
+
+	/** Tracing Data requested by Client and waiting for Server RPC budget, merged across requests. */
+	FTracingData																	RequestedTracingData;
+	EMounteaTracingDataFields													RequestedTracingDataFields;
+
 	/**
 	 * Timer Handle.
 	 * Won't display any values in Blueprints.
@@ -407,6 +587,24 @@ protected:
 	UPROPERTY(VisibleAnywhere, Category="MounteaInteraction|Read Only")
 	FTimerHandle																	Timer_Ticking;
 
+	/**
+	 * Timer sending latest Custom Trace Start once Send Interval has passed.
+	 */
+	FTimerHandle																	Timer_TraceOriginSend;
+
+	/**
+	 * Timer sending last Custom Trace Start reliably once it stopped changing.
+	 * On Server commits Custom Trace Start once it stopped changing instead.
+	 */
+	FTimerHandle																	Timer_TraceOriginSettle;
+
+	/** World time Custom Trace Start was last sent to Server. */
+	float																				LastTraceOriginSendTime;
+
+	/** Last quantized Custom Trace Start sent to Server. */
+	FVector_NetQuantize10													LastSentTraceOriginLocation;
+	uint32																			LastSentTraceOriginRotation;
+
 #pragma endregion
 
 #pragma region Events
@@ -426,6 +624,15 @@ protected:
 	UPROPERTY(BlueprintAssignable, Category="Mountea|Interaction|Interactor")
 	FOnTraced																		OnTraced;
 
+public:
+
+	/**
+	 * Native counterparts of the events above.
+	 * Dynamic events are broadcast only once Blueprint listener is bound.
+	 */
+	FTracingDataChangedNative													OnTraceDataChangedNative;
+	FOnTracedNative																OnTracedNative;
+
 #pragma endregion
 	
 #if WITH_EDITOR
@@ -0,0 +1,65 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Helpers/MounteaInteractionHelpers.h"
+
+/**
+ * Components found by Auto Setup of an Interactable, stored by their names.
+ *
+ * If all Components of an Owner are defined by its Class, Auto Setup finds the same Components for each instance.
+ * Template is built by the first Interactable of given Owner Class and Setup values,
+ * other Interactables resolve Components by name without iterating Owner's Components.
+ */
+struct MOUNTEAINTERACTIONSYSTEM_API FMounteaInteractableSetupTemplate
+{
+	/** Number of Owner Components the Template has been built from. Owners with different number do not match. */
+	int32						NumOwnerComponents = 0;
+
+	/** Collision and Highlightable Components found by Full Auto Setup. */
+	TArray<FName>			CollisionComponents;
+	TArray<FName>			HighlightableComponents;
+
+	/**
+	 * Components found for each Collision and Highlightable Override by name.
+	 * NAME_None if not found by name, such Override is resolved by tag for each instance, as tags may differ per instance.
+	 */
+	TArray<FName>			CollisionOverrideComponents;
+	TArray<FName>			HighlightableOverrideComponents;
+
+	/**
+	 * Returns Template for Owner Class and Setup values, building it on first use.
+	 * Returns null if Owner contains Components created by Construction Script or added to the instance.
+	 */
+	static const FMounteaInteractableSetupTemplate* Get(const AActor* Owner, const ESetupType SetupType, const TArray<FName>& CollisionOverrides, const TArray<FName>& HighlightableOverrides);
+
+	/**
+	 * Resolves named Components of Owner, NAME_None resolves to null.
+	 * Returns false if Owner does not match the Template.
+	 */
+	template<typename ComponentType>
+	bool Resolve(const AActor* Owner, const TArray<FName>& Names, TArray<ComponentType*>& OutComponents) const
+	{
+		if (!Owner || Owner->GetComponents().Num() != NumOwnerComponents) return false;
+
+		OutComponents.Reset(Names.Num());
+		for (const FName& Name : Names)
+		{
+			if (Name.IsNone())
+			{
+				OutComponents.Add(nullptr);
+				continue;
+			}
+
+			// Components are named subobjects of their Owner, so the lookup is a hash search
+			ComponentType* Component = FindObjectFast<ComponentType>(const_cast<AActor*>(Owner), Name);
+			if (!IsValid(Component)) return false;
+
+			OutComponents.Add(Component);
+		}
+
+		return true;
+	}
+};
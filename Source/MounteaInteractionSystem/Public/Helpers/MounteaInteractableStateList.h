@@ -0,0 +1,153 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagContainer.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "UObject/ObjectKey.h"
+#include "Helpers/MounteaInteractionHelpers.h"
+
+#include "MounteaInteractableStateList.generated.h"
+
+class UMounteaInteractableComponentBase;
+struct FMounteaInteractableStateList;
+
+/**
+ * Defines which values of Interactable State Snapshot differ from values loaded with the Interactable.
+ */
+enum class EMounteaInteractableSnapshotFlags : uint8
+{
+	None				= 0,
+	State				= 1 << 0,
+	Lifecycle			= 1 << 1,
+	Data				= 1 << 2,
+	Name				= 1 << 3,
+	Tags				= 1 << 4,
+
+	All					= State | Lifecycle | Data | Name | Tags
+};
+ENUM_CLASS_FLAGS(EMounteaInteractableSnapshotFlags)
+
+/**
+ * Non-default replicated state of a single Interactable.
+ * Only values marked in Flags are serialized.
+ */
+USTRUCT()
+struct FMounteaInteractableStateSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint8																	Flags = 0;
+
+	UPROPERTY()
+	EInteractableStateV2												State = EInteractableStateV2::Default;
+
+	UPROPERTY()
+	int32																	RemainingLifecycleCount = 0;
+
+	UPROPERTY()
+	FDataTableRowHandle												InteractableData;
+
+	UPROPERTY()
+	FText																	InteractableName;
+
+	UPROPERTY()
+	FGameplayTagContainer											InteractableCompatibleTags;
+
+	bool HasFlag(const EMounteaInteractableSnapshotFlags Flag) const
+	{ return EnumHasAnyFlags(static_cast<EMounteaInteractableSnapshotFlags>(Flags), Flag); };
+
+	/** Snapshot without any Flag describes Interactable in its loaded state. */
+	bool IsDefault() const
+	{ return Flags == 0; };
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	bool operator==(const FMounteaInteractableStateSnapshot& Other) const;
+
+	bool operator!=(const FMounteaInteractableStateSnapshot& Other) const
+	{ return !(*this == Other); };
+};
+
+template<>
+struct TStructOpsTypeTraits<FMounteaInteractableStateSnapshot> : public TStructOpsTypeTraitsBase2<FMounteaInteractableStateSnapshot>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true
+	};
+};
+
+/**
+ * Snapshot of a single Interactable replicated as Fast Array item.
+ */
+USTRUCT()
+struct FMounteaInteractableStateItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	FMounteaInteractableStateItem()
+	{}
+
+	FMounteaInteractableStateItem(UMounteaInteractableComponentBase* InInteractable, const FMounteaInteractableStateSnapshot& InSnapshot)
+		: Interactable(InInteractable)
+		, Snapshot(InSnapshot)
+	{}
+
+	/** Interactable Component. Stably named Components are resolved even if their Owner is not replicated to the Client. */
+	UPROPERTY()
+	TObjectPtr<UMounteaInteractableComponentBase>		Interactable = nullptr;
+
+	UPROPERTY()
+	FMounteaInteractableStateSnapshot							Snapshot;
+
+	void PreReplicatedRemove(const FMounteaInteractableStateList& InArraySerializer) const;
+	void PostReplicatedAdd(const FMounteaInteractableStateList& InArraySerializer) const;
+	void PostReplicatedChange(const FMounteaInteractableStateList& InArraySerializer) const;
+};
+
+/**
+ * List of all Interactables whose state differs from the loaded one.
+ *
+ * Replicated as Fast Array, so joining Client receives the whole list at once and only changed items afterwards.
+ */
+USTRUCT()
+struct FMounteaInteractableStateList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	/** Adds, updates or removes Interactable entry. Returns true if the list has changed. */
+	bool SetSnapshot(UMounteaInteractableComponentBase* Interactable, const FMounteaInteractableStateSnapshot& Snapshot);
+
+	/** Returns true if Interactable entry was removed. */
+	bool Remove(const UMounteaInteractableComponentBase* Interactable);
+
+	int32 Num() const
+	{ return Items.Num(); };
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParams)
+	{
+		return FastArrayDeltaSerialize<FMounteaInteractableStateItem, FMounteaInteractableStateList>(Items, DeltaParams, *this);
+	}
+
+private:
+
+	UPROPERTY()
+	TArray<FMounteaInteractableStateItem>									Items;
+
+	/** Server only lookup of Items by Interactable. */
+	TMap<TObjectKey<UMounteaInteractableComponentBase>, int32>		Indices;
+};
+
+template<>
+struct TStructOpsTypeTraits<FMounteaInteractableStateList> : public TStructOpsTypeTraitsBase2<FMounteaInteractableStateList>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
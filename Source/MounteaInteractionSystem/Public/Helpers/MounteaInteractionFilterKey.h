@@ -0,0 +1,53 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Engine/EngineTypes.h"
+
+/**
+ * Compiled Collision Channel and Gameplay Tags of Interactable or Interactor.
+ *
+ * Interactable key holds bits it provides: its Collision Channel, each Compatible Tag with all of its parents and Any Tag bit.
+ * Interactor key holds bits it requires: its Response Channel and its Tag, or Any Tag bit if it has no Tag.
+ * Interactor is compatible with Interactable if all required bits are provided, which is one masked compare per word.
+ *
+ * Bits of Gameplay Tags are assigned on first use and never released. Once they run out,
+ * keys using unassigned Tags require full matching instead.
+ */
+struct MOUNTEAINTERACTIONSYSTEM_API FMounteaInteractionFilterKey
+{
+	static constexpr int32 NumWords = 2;
+	static constexpr int32 NumChannelBits = 32;
+	static constexpr int32 AnyTagBit = NumChannelBits;
+	static constexpr int32 FirstTagBit = AnyTagBit + 1;
+	static constexpr int32 NumBits = NumWords * 64;
+
+	uint64 Bits[NumWords] = {};
+
+	/** Set if some Channel or Tag could not be compiled into bits. */
+	bool bRequiresFullMatch = false;
+
+	static FMounteaInteractionFilterKey MakeInteractable(const ECollisionChannel CollisionChannel, const FGameplayTagContainer& CompatibleTags);
+	static FMounteaInteractionFilterKey MakeInteractor(const ECollisionChannel ResponseChannel, const FGameplayTag& InteractorTag);
+
+	/** Returns whether Interactable provides all bits Interactor requires. Valid only if neither key requires full match. */
+	static bool Matches(const FMounteaInteractionFilterKey& InteractableKey, const FMounteaInteractionFilterKey& InteractorKey)
+	{
+		return ((InteractableKey.Bits[0] & InteractorKey.Bits[0]) == InteractorKey.Bits[0]) & ((InteractableKey.Bits[1] & InteractorKey.Bits[1]) == InteractorKey.Bits[1]);
+	};
+
+	/** Returns how many Gameplay Tags have their bit assigned. */
+	static int32 GetAssignedTagsCount();
+
+private:
+
+	void SetBit(const int32 Bit)
+	{ Bits[Bit / 64] |= 1ull << (Bit % 64); };
+
+	/** Sets bit of Channel, returns false if Channel has no bit. */
+	bool AddChannel(const ECollisionChannel Channel);
+	/** Sets bit of Tag, assigning new bit if needed. Returns false if Tag could not get a bit. */
+	bool AddTag(const FGameplayTag& Tag);
+};
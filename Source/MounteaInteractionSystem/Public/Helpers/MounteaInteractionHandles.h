@@ -0,0 +1,144 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ScriptInterface.h"
+
+#include "MounteaInteractionHandles.generated.h"
+
+class IMounteaInteractableInterface;
+class IMounteaInteractorInterface;
+class UMounteaInteractionRegistrySubsystem;
+
+/**
+ * Generational Handle of an Interactable.
+ *
+ * Index and Generation of a slot in Interaction Registry. Handle of destroyed Interactable never resolves,
+ * even if its slot is reused. Handles are unique across Worlds, so they are resolved without World context.
+ *
+ * Replicates as object reference and is resolved against the Registry of the receiving side.
+ */
+USTRUCT(BlueprintType)
+struct MOUNTEAINTERACTIONSYSTEM_API FMounteaInteractableHandle
+{
+	GENERATED_BODY()
+
+	FMounteaInteractableHandle()
+	{}
+
+	/** Returns Handle of Interactable, acquiring new one if needed. */
+	static FMounteaInteractableHandle Get(const UObject* Interactable);
+	static FMounteaInteractableHandle Get(const TScriptInterface<IMounteaInteractableInterface>& Interactable);
+
+	bool IsValid() const
+	{ return Generation != 0; };
+
+	void Reset()
+	{ *this = FMounteaInteractableHandle(); };
+
+	/** Returns Interactable Object or null if it does not exist anymore. */
+	UObject* GetObject() const;
+
+	/** Blueprint and interface adaptor. */
+	TScriptInterface<IMounteaInteractableInterface> GetInterface() const;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	bool operator==(const FMounteaInteractableHandle& Other) const
+	{ return Index == Other.Index && Generation == Other.Generation; };
+
+	bool operator!=(const FMounteaInteractableHandle& Other) const
+	{ return !(*this == Other); };
+
+	friend uint32 GetTypeHash(const FMounteaInteractableHandle& Handle)
+	{ return HashCombine(::GetTypeHash(Handle.Index), ::GetTypeHash(Handle.Generation)); };
+
+private:
+
+	friend UMounteaInteractionRegistrySubsystem;
+
+	FMounteaInteractableHandle(const int32 InIndex, const uint32 InGeneration)
+		: Index(InIndex)
+		, Generation(InGeneration)
+	{}
+
+	int32								Index = INDEX_NONE;
+	uint32								Generation = 0;
+};
+
+template<>
+struct TStructOpsTypeTraits<FMounteaInteractableHandle> : public TStructOpsTypeTraitsBase2<FMounteaInteractableHandle>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true
+	};
+};
+
+/**
+ * Generational Handle of an Interactor.
+ *
+ * Index and Generation of a slot in Interaction Registry. Handle of destroyed Interactor never resolves,
+ * even if its slot is reused. Handles are unique across Worlds, so they are resolved without World context.
+ *
+ * Replicates as object reference and is resolved against the Registry of the receiving side.
+ */
+USTRUCT(BlueprintType)
+struct MOUNTEAINTERACTIONSYSTEM_API FMounteaInteractorHandle
+{
+	GENERATED_BODY()
+
+	FMounteaInteractorHandle()
+	{}
+
+	/** Returns Handle of Interactor, acquiring new one if needed. */
+	static FMounteaInteractorHandle Get(const UObject* Interactor);
+	static FMounteaInteractorHandle Get(const TScriptInterface<IMounteaInteractorInterface>& Interactor);
+
+	bool IsValid() const
+	{ return Generation != 0; };
+
+	void Reset()
+	{ *this = FMounteaInteractorHandle(); };
+
+	/** Returns Interactor Object or null if it does not exist anymore. */
+	UObject* GetObject() const;
+
+	/** Blueprint and interface adaptor. */
+	TScriptInterface<IMounteaInteractorInterface> GetInterface() const;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	bool operator==(const FMounteaInteractorHandle& Other) const
+	{ return Index == Other.Index && Generation == Other.Generation; };
+
+	bool operator!=(const FMounteaInteractorHandle& Other) const
+	{ return !(*this == Other); };
+
+	friend uint32 GetTypeHash(const FMounteaInteractorHandle& Handle)
+	{ return HashCombine(::GetTypeHash(Handle.Index), ::GetTypeHash(Handle.Generation)); };
+
+private:
+
+	friend UMounteaInteractionRegistrySubsystem;
+
+	FMounteaInteractorHandle(const int32 InIndex, const uint32 InGeneration)
+		: Index(InIndex)
+		, Generation(InGeneration)
+	{}
+
+	int32								Index = INDEX_NONE;
+	uint32								Generation = 0;
+};
+
+template<>
+struct TStructOpsTypeTraits<FMounteaInteractorHandle> : public TStructOpsTypeTraitsBase2<FMounteaInteractorHandle>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true
+	};
+};
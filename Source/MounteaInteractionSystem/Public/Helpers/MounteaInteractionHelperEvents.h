@@ -7,6 +7,42 @@
 #include "MounteaInteractionHelperEvents.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInputActionConsumed, UInputAction*, ConsumedInput);
+DECLARE_MULTICAST_DELEGATE_OneParam(FInputActionConsumedNative, UInputAction*);
+
+namespace MounteaInteractionEvents
+{
+	/**
+	 * Broadcasts Native Delegate and then Dynamic Delegate.
+	 * Dynamic Delegate is broadcast only if any Blueprint listener is bound, as it is processed by ProcessEvent.
+	 */
+	template<typename NativeDelegateType, typename DynamicDelegateType, typename... ParamTypes>
+	void Broadcast(NativeDelegateType& NativeDelegate, DynamicDelegateType& DynamicDelegate, const ParamTypes&... Params)
+	{
+		NativeDelegate.Broadcast(Params...);
+
+		if (DynamicDelegate.IsBound())
+		{
+			DynamicDelegate.Broadcast(Params...);
+		}
+	}
+
+	/**
+	 * Broadcasts Native Delegate of other Object, if it provides any, and then its Dynamic Delegate.
+	 */
+	template<typename NativeDelegateType, typename DynamicDelegateType, typename... ParamTypes>
+	void Broadcast(NativeDelegateType* NativeDelegate, DynamicDelegateType& DynamicDelegate, const ParamTypes&... Params)
+	{
+		if (NativeDelegate)
+		{
+			NativeDelegate->Broadcast(Params...);
+		}
+
+		if (DynamicDelegate.IsBound())
+		{
+			DynamicDelegate.Broadcast(Params...);
+		}
+	}
+}
 
 UCLASS()
 class UMounteaInteractionHelperEvents : public UObject
@@ -6,6 +6,7 @@
 #include "GameplayTagContainer.h"
 #include "InputCoreTypes.h"
 #include "Engine/EngineTypes.h"
+#include "Engine/NetSerialization.h"
 #include "MounteaInteractionHelpers.generated.h"
 
 class UMaterialInterface;
@@ -189,12 +190,169 @@ enum class EHighlightType : uint8
 {
 	EHT_PostProcessing		UMETA(DisplayName="PostProcessing",			Tooltip="PostProcessing Material will be used. This option is highly optimised, however, requires Project setup."),
 	EHT_OverlayMaterial		UMETA(DisplayName="Overlay Material",		Tooltip="Overlay Material will be used. Unique for 5.1 and newer versions. For very complex meshes might cause performance issues."),
+	EHT_PersistentStencil	UMETA(DisplayName="PostProcessing (Persistent)",	Tooltip="PostProcessing Material will be used. Meshes are kept in Custom Depth pass permanently and only Stencil value is switched. Cheapest option when highlight changes often, however, requires Project setup."),
 
 	EHT_Default					UMETA(Hidden)
 };
 
 #pragma endregion
 
+#pragma region ReplicatedProgress
+
+/**
+ * Interaction Progress replicated to Clients.
+ * Running progress is described by Server start time and duration, so Clients extrapolate it locally without any traffic.
+ * Paused progress is quantized to a single byte.
+ */
+USTRUCT(BlueprintType)
+struct FMounteaReplicatedProgress
+{
+	GENERATED_BODY()
+
+	/** Server World time when progress would have been 0. Valid only while Duration is not zero. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Progress")
+	float StartServerTime = 0.f;
+
+	/** Duration of running progress. Zero if progress is not running. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Progress")
+	float Duration = 0.f;
+
+	/** Progress quantized to 0-255 while not running. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Progress")
+	uint8 QuantizedProgress = 0;
+
+	bool IsRunning() const
+	{ return Duration > 0.f; };
+
+	float GetProgress(const float ServerTime) const
+	{
+		if (IsRunning())
+		{
+			return FMath::Clamp((ServerTime - StartServerTime) / Duration, 0.f, 1.f);
+		}
+		return QuantizedProgress / 255.f;
+	}
+
+	static uint8 QuantizeProgress(const float Progress)
+	{
+		return static_cast<uint8>(FMath::RoundToInt(FMath::Clamp(Progress, 0.f, 1.f) * 255.f));
+	}
+
+	bool operator==(const FMounteaReplicatedProgress& Other) const
+	{
+		return StartServerTime == Other.StartServerTime && Duration == Other.Duration && QuantizedProgress == Other.QuantizedProgress;
+	}
+
+	bool operator!=(const FMounteaReplicatedProgress& Other) const
+	{ return !(*this == Other); };
+
+	/**
+	 * Only fields relevant to current state are sent.
+	 * Running progress sends start time and duration, paused progress sends a single byte.
+	 * Compact form is used by generic replication only, Iris has no dedicated Net Serializer for this struct.
+	 */
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+	{
+		uint8 bIsRunning = IsRunning() ? 1 : 0;
+		Ar.SerializeBits(&bIsRunning, 1);
+
+		if (bIsRunning)
+		{
+			Ar << StartServerTime;
+			Ar << Duration;
+			QuantizedProgress = 0;
+		}
+		else
+		{
+			Ar << QuantizedProgress;
+			StartServerTime = 0.f;
+			Duration = 0.f;
+		}
+
+		bOutSuccess = true;
+		return true;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FMounteaReplicatedProgress> : public TStructOpsTypeTraitsBase2<FMounteaReplicatedProgress>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true
+	};
+};
+
+#pragma endregion
+
+#pragma region CosmeticState
+
+/**
+ * Presentation state of Interactable which is replicated to owning Client.
+ */
+UENUM(meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EInteractableCosmeticState : uint8
+{
+	ICS_None				= 0			UMETA(Hidden),
+	// Interactable is highlighted.
+	ICS_Highlighted		= 1 << 0,
+	// Interactable widget is visible.
+	ICS_WidgetVisible	= 1 << 1,
+	// Interactable is active for its Interactor.
+	ICS_Active				= 1 << 2
+};
+ENUM_CLASS_FLAGS(EInteractableCosmeticState)
+
+#pragma endregion
+
+#pragma region ServerRPCBudget
+
+/**
+ * Groups of Interactor Server RPCs sharing one rate limit budget.
+ * Requests starting something are dropped once over budget.
+ * Stopping, State and configuration requests are coalesced instead, so only the latest value of each is applied once budget refills.
+ */
+UENUM(BlueprintType)
+enum class EMounteaServerRPCType : uint8
+{
+	ESRT_Interaction		UMETA(DisplayName="Interaction",	ToolTip="Start Interaction and Active Interactable requests."),
+	ESRT_Trace				UMETA(DisplayName="Trace",			ToolTip="Trace requests and Trace Origin updates. Raised to fit Trace Interval of each Interactor."),
+	ESRT_Overlap			UMETA(DisplayName="Overlap",		ToolTip="Start Overlap events sent by Clients."),
+	ESRT_State				UMETA(DisplayName="State",			ToolTip="State changes, Stop Interaction, Tracing toggles and dependency processing. Only latest request of each kind is applied once over budget."),
+	ESRT_Config				UMETA(DisplayName="Config",			ToolTip="Configuration changes, like Ignored Actors, Dependencies or Tracing Data. Only latest request of each kind is applied once over budget."),
+
+	Default						UMETA(hidden)
+};
+
+/**
+ * Token bucket budget of one Server RPC type.
+ * Each call consumes one token, tokens are refilled at constant rate up to Burst Size.
+ */
+USTRUCT(BlueprintType)
+struct FMounteaServerRPCBudget
+{
+	GENERATED_BODY()
+
+	/** How many calls per second are allowed in long term. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Budget", meta=(UIMin=0.1f, ClampMin=0.1f))
+	float TokensPerSecond = 10.f;
+
+	/** How many calls can be made at once. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Budget", meta=(UIMin=1, ClampMin=1))
+	int32 BurstSize = 10;
+
+	FMounteaServerRPCBudget()
+	{}
+
+	FMounteaServerRPCBudget(const float InTokensPerSecond, const int32 InBurstSize)
+		: TokensPerSecond(InTokensPerSecond)
+		, BurstSize(InBurstSize)
+	{}
+};
+
+#pragma endregion
+
 #pragma region HighlightSetup
 
 /**
@@ -208,7 +366,7 @@ struct FInteractionHighlightSetup
 	UPROPERTY(EditAnywhere, BlueprintReadOnly,  Category="Highlight Setup")
 	EHighlightType HighlightType;
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly,  Category="Highlight Setup", meta=(EditCondition="HighlightType==EHighlightType::EHT_PostProcessing"))
+	UPROPERTY(EditAnywhere, BlueprintReadOnly,  Category="Highlight Setup", meta=(EditCondition="HighlightType==EHighlightType::EHT_PostProcessing || HighlightType==EHighlightType::EHT_PersistentStencil"))
 	int32 StencilID;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly,  Category="Highlight Setup", meta=(EditCondition="HighlightType==EHighlightType::EHT_OverlayMaterial"))
@@ -224,6 +382,88 @@ struct FInteractionHighlightSetup
 
 #pragma endregion
 
+#pragma region HighlightMaterialParameters
+
+/**
+ * Scalar parameter applied to shared Highlight Material.
+ */
+USTRUCT(BlueprintType)
+struct FMounteaHighlightScalarParameter
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Highlight Setup")
+	FName ParameterName = NAME_None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Highlight Setup")
+	float Value = 0.f;
+
+	bool operator==(const FMounteaHighlightScalarParameter& Other) const
+	{
+		return ParameterName == Other.ParameterName && Value == Other.Value;
+	}
+};
+
+/**
+ * Vector parameter applied to shared Highlight Material.
+ */
+USTRUCT(BlueprintType)
+struct FMounteaHighlightVectorParameter
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Highlight Setup")
+	FName ParameterName = NAME_None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Highlight Setup")
+	FLinearColor Value = FLinearColor::White;
+
+	bool operator==(const FMounteaHighlightVectorParameter& Other) const
+	{
+		return ParameterName == Other.ParameterName && Value == Other.Value;
+	}
+};
+
+/**
+ * Set of parameters for Overlay Highlight Material.
+ * Interactables using same Material with same parameters share one Dynamic Material Instance.
+ */
+USTRUCT(BlueprintType)
+struct FMounteaHighlightMaterialParameters
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Highlight Setup")
+	TArray<FMounteaHighlightScalarParameter> ScalarParameters;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Highlight Setup")
+	TArray<FMounteaHighlightVectorParameter> VectorParameters;
+
+	bool IsEmpty() const
+	{ return ScalarParameters.Num() == 0 && VectorParameters.Num() == 0; };
+
+	bool operator==(const FMounteaHighlightMaterialParameters& Other) const
+	{
+		return ScalarParameters == Other.ScalarParameters && VectorParameters == Other.VectorParameters;
+	}
+
+	friend uint32 GetTypeHash(const FMounteaHighlightMaterialParameters& Parameters)
+	{
+		uint32 Hash = 0;
+		for (const auto& Itr : Parameters.ScalarParameters)
+		{
+			Hash = HashCombine(Hash, HashCombine(GetTypeHash(Itr.ParameterName), GetTypeHash(Itr.Value)));
+		}
+		for (const auto& Itr : Parameters.VectorParameters)
+		{
+			Hash = HashCombine(Hash, HashCombine(GetTypeHash(Itr.ParameterName), GetTypeHash(Itr.Value)));
+		}
+		return Hash;
+	}
+};
+
+#pragma endregion
+
 #pragma region SetupType
 /**
  * Enumerator definition of setup modes.
@@ -350,6 +590,51 @@ struct FSafetyTracingSetup
 		}
 	}
 
+	/**
+	 * Mode and Collision Channel are bit-packed and only fields used by the current Mode are sent.
+	 * Start Location is quantized to 1 decimal place.
+	 * Compact form is used by generic replication only, Iris has no dedicated Net Serializer for this struct.
+	 */
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+	{
+		uint8 PackedMode = static_cast<uint8>(SafetyTracingMode);
+		Ar.SerializeBits(&PackedMode, 2);
+		
+		uint8 PackedChannel = ValidationCollisionChannel.GetValue();
+		Ar.SerializeBits(&PackedChannel, 5);
+
+		if (Ar.IsLoading())
+		{
+			SafetyTracingMode = static_cast<ESafetyTracingMode>(PackedMode);
+			ValidationCollisionChannel = static_cast<ECollisionChannel>(PackedChannel);
+		}
+
+		bOutSuccess = true;
+		switch (SafetyTracingMode)
+		{
+			case ESafetyTracingMode::ESTM_Location:
+				bOutSuccess &= SerializePackedVector<10, 24>(StartLocation, Ar);
+				break;
+			case ESafetyTracingMode::ESTM_Socket:
+				Ar << ActorMeshName;
+				Ar << StartSocketName;
+				break;
+			case ESafetyTracingMode::ESTM_None:
+			default:
+				break;
+		}
+
+		return true;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FSafetyTracingSetup> : public TStructOpsTypeTraitsBase2<FSafetyTracingSetup>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
 };
 
 #pragma endregion
@@ -0,0 +1,99 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Engine/EngineTypes.h"
+#include "Helpers/MounteaInteractionFilterKey.h"
+#include "Helpers/MounteaInteractionHelpers.h"
+
+class UPrimitiveComponent;
+class IMounteaInteractableInterface;
+class IMounteaInteractorInterface;
+
+/**
+ * Interactable Interface functions which can be dispatched natively.
+ */
+enum class EMounteaInteractableNativeFunction : uint8
+{
+	GetState,
+	CanBeTriggered,
+	GetInteractor,
+	GetInteractableWeight,
+	GetCollisionChannel,
+	GetCollisionComponents,
+	GetInteractableName,
+	GetInteractableCompatibleTags,
+	GetIgnoredClasses,
+
+	MAX
+};
+
+/**
+ * Interactor Interface functions which can be dispatched natively.
+ */
+enum class EMounteaInteractorNativeFunction : uint8
+{
+	GetState,
+	IsValidInteractor,
+	CanInteract,
+	GetResponseChannel,
+	GetInteractorTag,
+	GetActiveInteractable,
+
+	MAX
+};
+
+/**
+ * Native dispatch of Interactable Interface functions.
+ *
+ * Calls C++ implementation of Interactable Component Base directly if the function is not overridden in Blueprint,
+ * otherwise falls back to Execute_ thunk. Overrides are resolved once per Class, when Component begins play.
+ */
+struct MOUNTEAINTERACTIONSYSTEM_API FMounteaInteractableDispatch
+{
+	/** Returns bitmask of EMounteaInteractableNativeFunction which Class does not override in Blueprint. Cached per Class. */
+	static uint32 GetNativeFunctions(const UClass* Class);
+
+	static EInteractableStateV2 GetState(const UObject* Interactable);
+	static bool CanBeTriggered(const UObject* Interactable);
+	static TScriptInterface<IMounteaInteractorInterface> GetInteractor(const UObject* Interactable);
+	static int32 GetInteractableWeight(const UObject* Interactable);
+	static ECollisionChannel GetCollisionChannel(const UObject* Interactable);
+	static TArray<UPrimitiveComponent*> GetCollisionComponents(const UObject* Interactable);
+	static FText GetInteractableName(const UObject* Interactable);
+	static FGameplayTagContainer GetInteractableCompatibleTags(const UObject* Interactable);
+
+	/**
+	 * Returns whether Interactable has Interactor's Response Channel and, if Interactor Tag is valid, contains it in Compatible Tags.
+	 * Native Interactables are matched by their compiled Filter Key. Others, or keys which could not be fully compiled,
+	 * fall back to Interface functions and full Tag matching.
+	 */
+	static bool IsCompatible(const UObject* Interactable, const FMounteaInteractionFilterKey& InteractorKey, const ECollisionChannel ResponseChannel, const FGameplayTag& InteractorTag);
+
+	/**
+	 * Returns whether Interactor's Class, or any of its parents, is in Interactable's Ignored Classes.
+	 * Native Interactables look it up in their resolved Ignored Classes, others check each loaded Ignored Class.
+	 */
+	static bool IsInteractorIgnored(const UObject* Interactable, const UObject* Interactor);
+};
+
+/**
+ * Native dispatch of Interactor Interface functions.
+ *
+ * Calls C++ implementation of Interactor Component Base directly if the function is not overridden in Blueprint,
+ * otherwise falls back to Execute_ thunk. Overrides are resolved once per Class, when Component begins play.
+ */
+struct MOUNTEAINTERACTIONSYSTEM_API FMounteaInteractorDispatch
+{
+	/** Returns bitmask of EMounteaInteractorNativeFunction which Class does not override in Blueprint. Cached per Class. */
+	static uint32 GetNativeFunctions(const UClass* Class);
+
+	static EInteractorStateV2 GetState(const UObject* Interactor);
+	static bool IsValidInteractor(const UObject* Interactor);
+	static bool CanInteract(const UObject* Interactor);
+	static ECollisionChannel GetResponseChannel(const UObject* Interactor);
+	static FGameplayTag GetInteractorTag(const UObject* Interactor);
+	static TScriptInterface<IMounteaInteractableInterface> GetActiveInteractable(const UObject* Interactor);
+};
@@ -0,0 +1,173 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Helpers/MounteaInteractionHelpers.h"
+
+#pragma region Actions
+
+/**
+ * Side effects of Interactable State transition.
+ *
+ * Actions are executed in declaration order, ChangeState marks valid transition and assigns new State.
+ */
+enum class EMounteaInteractableTransitionActions : uint16
+{
+	None							= 0,
+
+	CancelInteraction		= 1 << 0,
+	ChangeState				= 1 << 1,
+	StopHighlight				= 1 << 2,
+	BroadcastStateChanged	= 1 << 3,
+	ClearTimers				= 1 << 4,
+	LoseInteractor			= 1 << 5,
+	BindCollision				= 1 << 6,
+	UnbindCollision			= 1 << 7,
+	ClearCooldown			= 1 << 8,
+	Cleanup						= 1 << 9
+};
+ENUM_CLASS_FLAGS(EMounteaInteractableTransitionActions)
+
+/**
+ * Side effects of Interactor State transition.
+ *
+ * Actions are executed in declaration order, ChangeState marks valid transition and assigns new State.
+ */
+enum class EMounteaInteractorTransitionActions : uint8
+{
+	None							= 0,
+
+	ChangeState				= 1 << 0,
+	ProcessStateChanged	= 1 << 1
+};
+ENUM_CLASS_FLAGS(EMounteaInteractorTransitionActions)
+
+#pragma endregion
+
+#pragma region Tables
+
+/**
+ * Transition table indexed by [From][To] State.
+ *
+ * Missing entries are invalid transitions with no side effects.
+ * Target States out of range resolve to the last State, which is Default for both State enums.
+ */
+template<typename StateType, typename ActionsType>
+struct TMounteaStateTransitionTable
+{
+	using FStateType = StateType;
+
+	static constexpr int32 NumStates = static_cast<int32>(StateType::Default) + 1;
+
+	ActionsType Actions[NumStates][NumStates] = {};
+
+	constexpr void Add(const StateType From, const StateType To, const ActionsType InActions)
+	{ Actions[static_cast<int32>(From)][static_cast<int32>(To)] = InActions; };
+
+	/** Adds the same Actions for each From State. */
+	constexpr void Add(const std::initializer_list<StateType> From, const StateType To, const ActionsType InActions)
+	{
+		for (const StateType Itr : From)
+		{
+			Add(Itr, To, InActions);
+		}
+	}
+
+	constexpr ActionsType Get(const StateType From, const StateType To) const
+	{ return Actions[FMath::Min(static_cast<int32>(From), NumStates - 1)][FMath::Min(static_cast<int32>(To), NumStates - 1)]; };
+
+	constexpr bool IsValid(const StateType From, const StateType To) const
+	{ return EnumHasAnyFlags(Get(From, To), ActionsType::ChangeState); };
+};
+
+namespace MounteaInteractionStateMachine
+{
+	using FInteractableTable = TMounteaStateTransitionTable<EInteractableStateV2, EMounteaInteractableTransitionActions>;
+	using FInteractorTable = TMounteaStateTransitionTable<EInteractorStateV2, EMounteaInteractorTransitionActions>;
+
+	constexpr FInteractableTable MakeInteractableTable()
+	{
+		using EState = EInteractableStateV2;
+		using EActions = EMounteaInteractableTransitionActions;
+
+		constexpr EActions Notify = EActions::ChangeState | EActions::BroadcastStateChanged;
+		constexpr EActions Release = EActions::ChangeState | EActions::StopHighlight | EActions::BroadcastStateChanged | EActions::ClearTimers | EActions::LoseInteractor | EActions::UnbindCollision;
+		constexpr EActions Suppress = EActions::CancelInteraction | EActions::ChangeState | EActions::StopHighlight | EActions::BroadcastStateChanged;
+
+		FInteractableTable Table;
+
+		Table.Add({ EState::EIS_Paused, EState::EIS_Awake }, EState::EIS_Active, Notify);
+		Table.Add({ EState::EIS_Active, EState::EIS_Asleep, EState::EIS_Suppressed, EState::EIS_Cooldown, EState::EIS_Disabled, EState::EIS_Paused }, EState::EIS_Awake, Notify | EActions::BindCollision);
+		Table.Add({ EState::EIS_Active, EState::EIS_Paused, EState::EIS_Awake, EState::EIS_Suppressed, EState::EIS_Cooldown, EState::EIS_Disabled }, EState::EIS_Asleep, Release);
+		Table.Add({ EState::EIS_Awake, EState::EIS_Active }, EState::EIS_Cooldown, Notify | EActions::StopHighlight);
+		Table.Add({ EState::EIS_Suppressed, EState::EIS_Disabled }, EState::EIS_Cooldown, Release);
+		Table.Add(EState::EIS_Active, EState::EIS_Completed, EActions::ChangeState | EActions::Cleanup);
+		Table.Add({ EState::EIS_Active, EState::EIS_Paused, EState::EIS_Completed, EState::EIS_Awake, EState::EIS_Suppressed, EState::EIS_Cooldown, EState::EIS_Asleep }, EState::EIS_Disabled, Release);
+		Table.Add({ EState::EIS_Active, EState::EIS_Awake, EState::EIS_Asleep, EState::EIS_Disabled, EState::EIS_Paused }, EState::EIS_Suppressed, Suppress);
+		Table.Add(EState::EIS_Cooldown, EState::EIS_Suppressed, Suppress | EActions::ClearCooldown);
+		Table.Add(EState::EIS_Active, EState::EIS_Paused, Notify);
+
+		// Requesting Default State only stops highlight, whatever the current State is
+		for (int32 From = 0; From < FInteractableTable::NumStates; From++)
+		{
+			Table.Add(static_cast<EState>(From), EState::Default, EActions::StopHighlight);
+		}
+
+		return Table;
+	}
+
+	constexpr FInteractorTable MakeInteractorTable()
+	{
+		using EState = EInteractorStateV2;
+		using EActions = EMounteaInteractorTransitionActions;
+
+		constexpr EActions Notify = EActions::ChangeState | EActions::ProcessStateChanged;
+
+		FInteractorTable Table;
+
+		Table.Add({ EState::EIS_Asleep, EState::EIS_Disabled, EState::EIS_Suppressed, EState::EIS_Active }, EState::EIS_Awake, Notify);
+		Table.Add({ EState::EIS_Awake, EState::EIS_Suppressed, EState::EIS_Active, EState::EIS_Disabled }, EState::EIS_Asleep, Notify);
+		Table.Add({ EState::EIS_Awake, EState::EIS_Asleep, EState::EIS_Active }, EState::EIS_Suppressed, Notify);
+		Table.Add(EState::EIS_Awake, EState::EIS_Active, Notify);
+		Table.Add({ EState::EIS_Asleep, EState::EIS_Awake, EState::EIS_Suppressed, EState::EIS_Active }, EState::EIS_Disabled, Notify);
+
+		return Table;
+	}
+
+	inline constexpr FInteractableTable InteractableTransitions = MakeInteractableTable();
+	inline constexpr FInteractorTable InteractorTransitions = MakeInteractorTable();
+}
+
+#pragma endregion
+
+#pragma region Trace
+
+DECLARE_MULTICAST_DELEGATE_FiveParams(FOnInteractableTransitionNative, const UObject* /*Interactable*/, EInteractableStateV2 /*From*/, EInteractableStateV2 /*To*/, EMounteaInteractableTransitionActions /*Actions*/, const TCHAR* /*Cause*/);
+DECLARE_MULTICAST_DELEGATE_FiveParams(FOnInteractorTransitionNative, const UObject* /*Interactor*/, EInteractorStateV2 /*From*/, EInteractorStateV2 /*To*/, EMounteaInteractorTransitionActions /*Actions*/, const TCHAR* /*Cause*/);
+
+namespace MounteaInteractionStateMachine
+{
+	/** Called for each requested State transition on authority, including invalid ones. Game thread only. */
+	MOUNTEAINTERACTIONSYSTEM_API FOnInteractableTransitionNative& OnInteractableTransition();
+	MOUNTEAINTERACTIONSYSTEM_API FOnInteractorTransitionNative& OnInteractorTransition();
+
+	/** Cause reported for transitions requested within current scope. Null outside of any scope. */
+	MOUNTEAINTERACTIONSYSTEM_API const TCHAR* GetTransitionCause();
+
+	/**
+	 * Names the cause of State transitions requested within its scope.
+	 * Scopes nest, innermost cause wins. Cause must be a string literal, it is stored by pointer.
+	 */
+	struct MOUNTEAINTERACTIONSYSTEM_API FScopedTransitionCause
+	{
+		explicit FScopedTransitionCause(const TCHAR* InCause);
+		~FScopedTransitionCause();
+
+	private:
+
+		const TCHAR* PreviousCause = nullptr;
+	};
+}
+
+#pragma endregion
@@ -58,6 +58,38 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Helpers")
 	static UPrimitiveComponent* FindPrimitiveByName(const FName Name, const AActor* Source);
 
+	/**
+	 * Finds primitive components for multiple names within the specified actor.
+	 * Each value is searched as component name first and as component tag if no component of that name exists.
+	 *
+	 * @param NamesOrTags		The names or tags to search for.
+	 * @param Source				The actor to search within.
+	 * @return							Component found for each value, in the same order. Entries are nullptr if nothing is found.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Helpers")
+	static TArray<UPrimitiveComponent*> FindPrimitivesByNameOrTag(const TArray<FName>& NamesOrTags, const AActor* Source);
+
+	/**
+	 * Finds mesh components for multiple names within the specified actor.
+	 * Each value is searched as component name first and as component tag if no component of that name exists.
+	 *
+	 * @param NamesOrTags		The names or tags to search for.
+	 * @param Source				The actor to search within.
+	 * @return							Component found for each value, in the same order. Entries are nullptr if nothing is found.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Helpers")
+	static TArray<UMeshComponent*> FindMeshesByNameOrTag(const TArray<FName>& NamesOrTags, const AActor* Source);
+
+	/**
+	 * Drops cached component lookup of the specified actor.
+	 * Lookup is rebuilt automatically once the number of actor components changes,
+	 * call this after renaming components or replacing one component with another.
+	 *
+	 * @param Source				The actor whose lookup is dropped.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Interaction|Helpers")
+	static void InvalidateComponentLookup(const AActor* Source);
+
 	/**
 	 * Retrieves the interaction system settings.
 	 *
@@ -45,6 +45,81 @@ public:
 	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Widgets", meta=(Units="s", UIMin=0.001, ClampMin=0.001))
 	float																WidgetUpdateFrequency =					0.05f;
 
+	/**
+	 * Defines into how many steps is Interaction Progress quantized when driving Highlight Material.
+	 * Interactables in the same step share one Material Instance.
+	 */
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Highlight", meta=(UIMin=1, ClampMin=1, UIMax=100, ClampMax=100))
+	int32																HighlightProgressSteps =					10;
+
+	/**
+	 * Defines whether Interactables manage Net Dormancy of their Owners.
+	 * Owner whose Interactables are all idle in their Default State without Interactor is put to DormantAll and woken up once replicated state changes.
+	 * All Owners are managed except those set to Never and those whose Interactable disables Manage Owner Net Dormancy.
+	 */
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Networking")
+	uint8															bEnableInteractableNetDormancy : 1;
+
+	/**
+	 * Defines whether Interactor Server RPCs are rate limited per Client Connection.
+	 * Requests starting something are dropped once over budget, before any work is done.
+	 * Stopping, State and configuration RPCs are coalesced instead, so Client cannot get out of sync with Server.
+	 */
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Networking")
+	uint8															bEnableServerRPCRateLimiting : 1;
+
+	/**
+	 * Budget of each Server RPC type.
+	 * Types without budget are not limited.
+	 */
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Networking", meta=(EditCondition="bEnableServerRPCRateLimiting"))
+	TMap<EMounteaServerRPCType, FMounteaServerRPCBudget>	ServerRPCBudgets;
+
+	/**
+	 * Defines whether Server spawns Interaction State Manager.
+	 * Manager replicates state of all Interactables which differ from their loaded state in one list,
+	 * so Clients joining mid-match do not need initial bunch of each Interactable.
+	 * Works best together with Interactable Net Dormancy and Owners placed in level as Initially Dormant.
+	 */
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Networking")
+	uint8															bEnableInteractionStateManager : 1;
+
+	/**
+	 * Range in which Interactables are relevant to Connection's viewers.
+	 * Used by Interactables Replication Graph Node only.
+	 */
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Networking|Replication Graph", meta=(Units="cm", UIMin=100.f, ClampMin=100.f))
+	float																InteractableRelevancyRange =					3000.f;
+
+	/**
+	 * Replication period, in frames, of Interactables with an Interactor.
+	 * Used by Interactables Replication Graph Node only.
+	 */
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Networking|Replication Graph", meta=(UIMin=1, ClampMin=1))
+	int32																ActiveInteractableReplicationPeriodFrame =	1;
+
+	/**
+	 * Replication period, in frames, of Interactables without an Interactor.
+	 * Used by Interactables Replication Graph Node only.
+	 */
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Networking|Replication Graph", meta=(UIMin=1, ClampMin=1))
+	int32																IdleInteractableReplicationPeriodFrame =		8;
+
+	/**
+	 * Defines whether Interactables finish their registration over multiple frames.
+	 * Registration and Auto Setup of Interactables which begin play in one frame are queued and processed within Registration Budget each frame.
+	 * Useful when many Interactables are spawned at once, like loot drops.
+	 */
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Performance")
+	uint8															bTimeSliceInteractableRegistration : 1;
+
+	/**
+	 * Time per frame spent on finishing registration of queued Interactables.
+	 * At least one Interactable is registered each frame.
+	 */
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Performance", meta=(Units="ms", UIMin=0.01f, ClampMin=0.01f, EditCondition="bTimeSliceInteractableRegistration"))
+	float																InteractableRegistrationBudget =				1.f;
+
 	/** Defines default Interactable Widget class.*/
 	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Widgets", meta=(AllowedClasses="/Script/UMG.UserWidget", MustImplement="/Script/ActorInteractionSystem.ActorInteractionWidget"))
 	TSoftClassPtr<UUserWidget>						InteractableDefaultWidgetClass;
@@ -85,6 +160,36 @@ public:
 	float GetWidgetUpdateFrequency() const
 	{ return WidgetUpdateFrequency; }
 
+	int32 GetHighlightProgressSteps() const
+	{ return HighlightProgressSteps; };
+
+	bool IsInteractableNetDormancyEnabled() const
+	{ return bEnableInteractableNetDormancy; };
+
+	bool IsServerRPCRateLimitingEnabled() const
+	{ return bEnableServerRPCRateLimiting; };
+
+	bool IsInteractionStateManagerEnabled() const
+	{ return bEnableInteractionStateManager; };
+
+	const FMounteaServerRPCBudget* FindServerRPCBudget(const EMounteaServerRPCType RPCType) const
+	{ return ServerRPCBudgets.Find(RPCType); };
+
+	float GetInteractableRelevancyRange() const
+	{ return InteractableRelevancyRange; };
+
+	int32 GetActiveInteractableReplicationPeriodFrame() const
+	{ return ActiveInteractableReplicationPeriodFrame; };
+
+	int32 GetIdleInteractableReplicationPeriodFrame() const
+	{ return IdleInteractableReplicationPeriodFrame; };
+
+	bool IsInteractableRegistrationTimeSliced() const
+	{ return bTimeSliceInteractableRegistration; };
+
+	float GetInteractableRegistrationBudget() const
+	{ return InteractableRegistrationBudget; };
+
 	TSoftObjectPtr<UDataTable> GetInteractableDefaultDataTable() const
 	{ return InteractableDefaultDataTable; };
 
@@ -0,0 +1,13 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+// Stat group definition
+DECLARE_STATS_GROUP(TEXT("MounteaInteraction"), STATGROUP_MounteaInteraction, STATCAT_Advanced);
+
+// Stat declarations
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Dormant Interactables"), STAT_MounteaDormantInteractables, STATGROUP_MounteaInteraction, MOUNTEAINTERACTIONSYSTEM_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Dropped Server RPCs"), STAT_MounteaDroppedServerRPCs, STATGROUP_MounteaInteraction, MOUNTEAINTERACTIONSYSTEM_API);
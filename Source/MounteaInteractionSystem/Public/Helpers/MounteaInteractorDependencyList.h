@@ -0,0 +1,102 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "Helpers/MounteaInteractionHandles.h"
+#include "Interfaces/MounteaInteractorInterface.h"
+
+#include "MounteaInteractorDependencyList.generated.h"
+
+class UMounteaInteractorComponentBase;
+struct FMounteaInteractorDependencyList;
+
+/**
+ * Single Interaction Dependency replicated as Fast Array item.
+ */
+USTRUCT()
+struct FMounteaInteractorDependencyItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	FMounteaInteractorDependencyItem()
+	{}
+
+	FMounteaInteractorDependencyItem(const FMounteaInteractorHandle& InDependency, UObject* InDependencyObject)
+		: Dependency(InDependency)
+		, DependencyObject(InDependencyObject)
+	{}
+
+	UPROPERTY()
+	FMounteaInteractorHandle									Dependency;
+
+	/**
+	 * Object the Handle was resolved to, so item whose Handle does not resolve anymore can still be found.
+	 * On Clients valid only once the Dependency has been announced to Owner.
+	 */
+	UPROPERTY(NotReplicated)
+	TWeakObjectPtr<UObject>										DependencyObject;
+
+	void PreReplicatedRemove(const FMounteaInteractorDependencyList& InArraySerializer);
+	void PostReplicatedAdd(const FMounteaInteractorDependencyList& InArraySerializer);
+	/** Called once unmapped Dependency is resolved as well, so it is announced late. */
+	void PostReplicatedChange(const FMounteaInteractorDependencyList& InArraySerializer);
+
+	/** Returns whether Dependency was destroyed or its Handle was released. */
+	bool IsStale() const;
+};
+
+/**
+ * List of Interaction Dependencies of an Interactor.
+ *
+ * Replicated as Fast Array, so adding or removing a Dependency sends only that item.
+ * Clients are notified about each added and removed item by the owning Interactor.
+ */
+USTRUCT()
+struct FMounteaInteractorDependencyList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	bool Contains(const TScriptInterface<IMounteaInteractorInterface>& Dependency) const;
+
+	/** Returns true if Dependency was added. Stale items are removed first. */
+	bool Add(const TScriptInterface<IMounteaInteractorInterface>& Dependency);
+
+	/** Returns true if Dependency was removed. Stale items are removed as well. */
+	bool Remove(const TScriptInterface<IMounteaInteractorInterface>& Dependency);
+
+	int32 Num() const
+	{ return Items.Num(); };
+
+	TArray<TScriptInterface<IMounteaInteractorInterface>> GetDependencies() const;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParams)
+	{
+		return FastArrayDeltaSerialize<FMounteaInteractorDependencyItem, FMounteaInteractorDependencyList>(Items, DeltaParams, *this);
+	}
+
+private:
+
+	/** Removes items of destroyed Dependencies and of Dependencies whose Handle was released. Returns whether any was removed. */
+	bool RemoveStaleItems();
+
+	friend UMounteaInteractorComponentBase;
+	friend FMounteaInteractorDependencyItem;
+
+	UPROPERTY()
+	TArray<FMounteaInteractorDependencyItem>			Items;
+
+	/** Interactor owning this list, notified about replicated changes. Set once the Interactor is initialized, never serialized. */
+	UPROPERTY(NotReplicated, Transient)
+	TObjectPtr<UMounteaInteractorComponentBase>		Owner = nullptr;
+};
+
+template<>
+struct TStructOpsTypeTraits<FMounteaInteractorDependencyList> : public TStructOpsTypeTraitsBase2<FMounteaInteractorDependencyList>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
@@ -78,6 +78,56 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractableDependencyStopped, cons
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractableWidgetVisibilityChanged, const bool, bIsVisible);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FInteractionDeviceChanged, const ECommonInputType, DeviceType, const FName&, DeviceName);
+
+// Native counterparts of the events above. Broadcast before the dynamic ones, which are broadcast only if a Blueprint listener is bound.
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractorFoundNative, const TScriptInterface<IMounteaInteractorInterface>&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractorLostNative, const TScriptInterface<IMounteaInteractorInterface>&);
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnInteractableSelectedNative, const TScriptInterface<IMounteaInteractableInterface>&);
+
+DECLARE_MULTICAST_DELEGATE_FiveParams(FInteractorTracedNative, UPrimitiveComponent*, AActor*, UPrimitiveComponent*, FVector, const FHitResult&);
+DECLARE_MULTICAST_DELEGATE_SixParams(FInteractorOverlappedNative, UPrimitiveComponent*, AActor*, UPrimitiveComponent*, int32, bool, const FHitResult &);
+DECLARE_MULTICAST_DELEGATE_FourParams(FInteractorStopOverlapNative, UPrimitiveComponent*, AActor*, UPrimitiveComponent*, int32);
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FInteractionCompletedNative, const float&, const TScriptInterface<IMounteaInteractorInterface>&);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FInteractionCycleCompletedNative, const float&, const int32, const TScriptInterface<IMounteaInteractorInterface>&);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FInteractionStartedNative, const float&, const TScriptInterface<IMounteaInteractorInterface>&);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FInteractionStoppedNative, const float&, const TScriptInterface<IMounteaInteractorInterface>&);
+DECLARE_MULTICAST_DELEGATE(FInteractionCanceledNative);
+
+DECLARE_MULTICAST_DELEGATE(FLifecycleCompletedNative);
+DECLARE_MULTICAST_DELEGATE(FCooldownCompletedNative);
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractableDependencyChangedNative, const TScriptInterface<IMounteaInteractableInterface>&);
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractableAutoSetupChangedNative, const bool);
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractableWeightChangedNative, const int32&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractableStateChangedNative, const EInteractableStateV2&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractableOwnerChangedNative, const AActor*);
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractableCollisionChannelChangedNative, const ECollisionChannel);
+DECLARE_MULTICAST_DELEGATE_OneParam(FLifecycleModeChangedNative, const EInteractableLifecycle&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FLifecycleCountChangedNative, const int32);
+DECLARE_MULTICAST_DELEGATE_OneParam(FCooldownPeriodChangedNative, const float);
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractorChangedNative, const TScriptInterface<IMounteaInteractorInterface>&);
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FIgnoredInteractorClassAddedNative, const TSoftClassPtr<UObject>&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FIgnoredInteractorClassRemovedNative, const TSoftClassPtr<UObject>&);
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FHighlightableComponentAddedNative, const UMeshComponent*);
+DECLARE_MULTICAST_DELEGATE_OneParam(FCollisionComponentAddedNative, const UPrimitiveComponent*);
+DECLARE_MULTICAST_DELEGATE_OneParam(FHighlightableComponentRemovedNative, const UMeshComponent*);
+DECLARE_MULTICAST_DELEGATE_OneParam(FCollisionComponentRemovedNative, const UPrimitiveComponent*);
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FHighlightTypeChangedNative, const EHighlightType&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FHighlightMaterialChangedNative, const UMaterialInterface*);
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractableDependencyStartedNative, const TScriptInterface<IMounteaInteractableInterface>&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractableDependencyStoppedNative, const TScriptInterface<IMounteaInteractableInterface>&);
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractableWidgetVisibilityChangedNative, const bool);
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FInteractionDeviceChangedNative, const ECommonInputType, const FName&);
+
 /**
  * 
  */
@@ -1040,6 +1090,10 @@ public:
 	virtual void OnInputDeviceChanged_Implementation(const ECommonInputType DeviceType, const FName& DeviceName) =0;
 	
 	
+	/**
+	 * Handles for binding listeners to this Interactable's events.
+	 * Do not broadcast them directly, that skips Native listeners and own handlers; raise events through Broadcast functions below.
+	 */
 	virtual FOnInteractableSelected& GetOnInteractableSelectedHandle() = 0;
 	virtual FInteractorFound& GetOnInteractorFoundHandle() = 0;
 	virtual FInteractorLost& GetOnInteractorLostHandle() = 0;
@@ -1066,4 +1120,30 @@ public:
 
 	virtual FInputActionConsumed& GetInputActionConsumedHandle() = 0;
 	virtual FInteractionDeviceChanged& GetInteractionDeviceChangedHandle() = 0;
+
+	/**
+	 * Broadcasts events of this Interactable on behalf of Interactors and other Interactables.
+	 * This is the only route for raising events from outside, Event Handles above are meant for binding.
+	 * Implementations with Native events override these to notify Native listeners and own handlers as well.
+	 */
+	virtual void BroadcastInteractableSelected(const TScriptInterface<IMounteaInteractableInterface>& SelectedInteractable)
+	{ GetOnInteractableSelectedHandle().Broadcast(SelectedInteractable); };
+	virtual void BroadcastInteractorFound(const TScriptInterface<IMounteaInteractorInterface>& FoundInteractor)
+	{ GetOnInteractorFoundHandle().Broadcast(FoundInteractor); };
+	virtual void BroadcastInteractorLost(const TScriptInterface<IMounteaInteractorInterface>& LostInteractor)
+	{ GetOnInteractorLostHandle().Broadcast(LostInteractor); };
+	virtual void BroadcastInteractorTraced(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
+	{ GetOnInteractorTracedHandle().Broadcast(HitComponent, OtherActor, OtherComp, NormalImpulse, Hit); };
+	virtual void BroadcastInteractorOverlapped(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+	{ GetOnInteractorOverlappedHandle().Broadcast(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex, bFromSweep, SweepResult); };
+	virtual void BroadcastInteractorStopOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+	{ GetOnInteractorStopOverlapHandle().Broadcast(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex); };
+	virtual void BroadcastInteractionStarted(const float& TimeStarted, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor)
+	{ GetOnInteractionStartedHandle().Broadcast(TimeStarted, CausingInteractor); };
+	virtual void BroadcastInteractionStopped(const float& TimeStopped, const TScriptInterface<IMounteaInteractorInterface>& CausingInteractor)
+	{ GetOnInteractionStoppedHandle().Broadcast(TimeStopped, CausingInteractor); };
+	virtual void BroadcastInteractableDependencyStarted(const TScriptInterface<IMounteaInteractableInterface>& NewMaster)
+	{ GetInteractableDependencyStarted().Broadcast(NewMaster); };
+	virtual void BroadcastInteractableDependencyStopped(const TScriptInterface<IMounteaInteractableInterface>& FormerMaster)
+	{ GetInteractableDependencyStopped().Broadcast(FormerMaster); };
 };
\ No newline at end of file
@@ -23,6 +23,7 @@ class UMounteaInteractorInterface : public UInterface
 
 enum class EInteractorStateV2 : uint8;
 class IMounteaInteractableInterface;
+class IMounteaInteractorInterface;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractableSelected,			const TScriptInterface<IMounteaInteractableInterface>&, SelectedInteractable);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractableFound,				const TScriptInterface<IMounteaInteractableInterface>&, FoundInteractable);
@@ -40,6 +41,26 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAutoActivateChanged,		const bool, N
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractorTagChanged,		const FGameplayTag&, NewTag);
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractionDependencyAdded,		const TScriptInterface<IMounteaInteractorInterface>&, AddedDependency);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractionDependencyRemoved,	const TScriptInterface<IMounteaInteractorInterface>&, RemovedDependency);
+
+// Native counterparts of the events above, used by C++ listeners.
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractableSelectedNative, const TScriptInterface<IMounteaInteractableInterface>&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractableFoundNative, const TScriptInterface<IMounteaInteractableInterface>&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractableLostNative, const TScriptInterface<IMounteaInteractableInterface>&);
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FIgnoredActorAddedNative, const AActor*);
+DECLARE_MULTICAST_DELEGATE_OneParam(FIgnoredActorRemovedNative, const AActor*);
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FStateChangedNative, const EInteractorStateV2&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FCollisionChangedNative, const TEnumAsByte<ECollisionChannel>&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FAutoActivateChangedNative, const bool);
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractorTagChangedNative, const FGameplayTag&);
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractionDependencyAddedNative, const TScriptInterface<IMounteaInteractorInterface>&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FInteractionDependencyRemovedNative, const TScriptInterface<IMounteaInteractorInterface>&);
+
 /**
  * 
  */
@@ -549,6 +570,10 @@ public:
 	void ConsumeInput(UInputAction* ConsumedInput);
 	virtual void ConsumeInput_Implementation(UInputAction* ConsumedInput) = 0;
 	
+	/**
+	 * Handles for binding listeners to this Interactor's events.
+	 * Events with Native counterparts are raised by the Interactor itself; broadcasting these handles directly skips Native listeners and own handlers.
+	 */
 	virtual FInteractableSelected& GetOnInteractableSelectedHandle() = 0;
 	virtual FInteractableFound& GetOnInteractableFoundHandle() = 0;
 	virtual FInteractableLost& GetOnInteractableLostHandle() = 0;
@@ -558,4 +583,7 @@ public:
 	virtual FStateChanged& GetOnStateChangedHandle() = 0;
 
 	virtual FInputActionConsumed& GetInputActionConsumedHandle() = 0;
+
+	/** Native Handle broadcast alongside the Dynamic one. Implementations which do not provide it return null. */
+	virtual FInputActionConsumedNative* GetInputActionConsumedNativeHandle() { return nullptr; };
 };
\ No newline at end of file
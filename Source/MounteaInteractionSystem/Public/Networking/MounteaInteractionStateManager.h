@@ -0,0 +1,55 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Info.h"
+#include "Helpers/MounteaInteractableStateList.h"
+
+#include "MounteaInteractionStateManager.generated.h"
+
+class UMounteaInteractableComponentBase;
+
+/**
+ * Mountea Interaction State Manager
+ *
+ * Optional always relevant Actor replicating state of all Interactables which differ from their loaded state.
+ * Joining Client receives the whole list in one Fast Array and only changed entries afterwards,
+ * so Startup Interactables can stay Initially Dormant instead of replicating their own initial bunches.
+ *
+ * Spawned by Interaction Registry on Server when enabled in Mountea Interaction System Settings.
+ */
+UCLASS(NotBlueprintable, NotPlaceable, Transient)
+class MOUNTEAINTERACTIONSYSTEM_API AMounteaInteractionStateManager : public AInfo
+{
+	GENERATED_BODY()
+
+public:
+
+	AMounteaInteractionStateManager();
+
+	static AMounteaInteractionStateManager* Get(const UObject* WorldContextObject);
+
+	/** Updates replicated Snapshot of Interactable. Default Snapshots are removed from the list. Server only. */
+	void UpdateInteractable(UMounteaInteractableComponentBase* Interactable, const FMounteaInteractableStateSnapshot& Snapshot);
+
+	/** Removes Interactable from the list. Server only. */
+	void RemoveInteractable(const UMounteaInteractableComponentBase* Interactable);
+
+	/** Returns how many Interactables differ from their loaded state. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|State Manager")
+	int32 GetSnapshotsCount() const
+	{ return InteractableStates.Num(); };
+
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+private:
+
+	UPROPERTY(Replicated)
+	FMounteaInteractableStateList											InteractableStates;
+};
@@ -0,0 +1,189 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Helpers/MounteaInteractionHelpers.h"
+
+#include "MounteaHighlightSubsystem.generated.h"
+
+class UMeshComponent;
+class UMaterialInterface;
+class UMaterialInstanceDynamic;
+
+/**
+ * Single highlight request made by one Interactable for one Mesh.
+ */
+struct FMounteaHighlightRequest
+{
+	/** Object which requested the highlight, usually Interactable Component. */
+	TWeakObjectPtr<const UObject>				Requester;
+
+	EHighlightType									HighlightType = EHighlightType::EHT_Default;
+
+	bool													bRenderCustomDepth = true;
+
+	int32													StencilValue = 0;
+
+	TWeakObjectPtr<UMaterialInterface>		OverlayMaterial;
+};
+
+/**
+ * Mountea Highlight Subsystem
+ *
+ * Collects highlight requests during the frame and applies only the net change once the world has ticked.
+ * Meshes shared between multiple Interactables are deduplicated, so flapping Start/Stop Highlight
+ * within one frame results in no render state update at all.
+ */
+UCLASS()
+class MOUNTEAINTERACTIONSYSTEM_API UMounteaHighlightSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UMounteaHighlightSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Queues highlight of the Mesh. Replaces any previous request of the same Requester for this Mesh.
+	 */
+	void RequestHighlight(UMeshComponent* Mesh, const FMounteaHighlightRequest& Request);
+
+	/**
+	 * Queues removal of the highlight Requester has applied to the Mesh.
+	 */
+	void ClearHighlight(UMeshComponent* Mesh, const UObject* Requester);
+
+	/**
+	 * Applies all pending requests immediately.
+	 */
+	void FlushHighlights();
+
+	/**
+	 * Returns Dynamic Material Instance of Base Material with given Parameters.
+	 * Instances are shared between all Interactables requesting the same combination.
+	 * If no Parameters are provided, Base Material is returned.
+	 */
+	UMaterialInterface* GetSharedHighlightMaterial(UMaterialInterface* BaseMaterial, const FMounteaHighlightMaterialParameters& Parameters);
+
+	/**
+	 * Starts Overlay highlight whose Progress parameter is driven by this Subsystem.
+	 * Progress is quantized to steps defined in Settings, so Interactables in the same step share one Material Instance.
+	 */
+	void StartProgressHighlight(UObject* Requester, const TArray<UMeshComponent*>& Meshes, const FMounteaHighlightRequest& Request, const FMounteaHighlightMaterialParameters& Parameters, const FName& ProgressParameterName);
+
+	/**
+	 * Stops driving Progress parameter for given Requester.
+	 */
+	void StopProgressHighlight(const UObject* Requester);
+
+	/** Returns how many render state updates would have been made without batching. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Highlight")
+	int32 GetRequestedUpdatesCount() const
+	{ return RequestedUpdates; };
+
+	/** Returns how many render state updates were actually made. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Highlight")
+	int32 GetAppliedUpdatesCount() const
+	{ return AppliedUpdates; };
+
+	/** Returns how many render state updates were saved by batching and deduplication. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Highlight")
+	int32 GetSavedUpdatesCount() const
+	{ return FMath::Max(0, RequestedUpdates - AppliedUpdates); };
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+private:
+
+	struct FMeshHighlightEntry
+	{
+		TWeakObjectPtr<UMeshComponent>				Mesh;
+		TArray<FMounteaHighlightRequest>			Requests;
+
+		/** Whether the stencil value of this mesh is managed by highlight. */
+		bool														bOwnsStencil = false;
+		/** Whether the overlay material of this mesh is managed by highlight. */
+		bool														bOwnsOverlay = false;
+		/** Overlay material applied to this mesh, counted as its Shared Material reference. */
+		TObjectKey<UMaterialInterface>						AppliedOverlayMaterial;
+	};
+
+	FMeshHighlightEntry& FindOrAddEntry(UMeshComponent* Mesh);
+
+	static int32 CountRenderUpdates(const EHighlightType HighlightType, const bool bIsStart);
+
+	void ApplyEntry(FMeshHighlightEntry& Entry);
+
+	struct FProgressHighlightEntry
+	{
+		TWeakObjectPtr<UObject>								Requester;
+		TArray<TWeakObjectPtr<UMeshComponent>>		Meshes;
+		FMounteaHighlightRequest								Request;
+		TWeakObjectPtr<UMaterialInterface>					BaseMaterial;
+		FMounteaHighlightMaterialParameters				Parameters;
+		FName															ProgressParameterName;
+		int32															LastStep = INDEX_NONE;
+	};
+
+	void UpdateProgressHighlights();
+
+	struct FSharedMaterialKey
+	{
+		TObjectKey<UMaterialInterface>						BaseMaterial;
+		FMounteaHighlightMaterialParameters				Parameters;
+
+		bool operator==(const FSharedMaterialKey& Other) const
+		{
+			return BaseMaterial == Other.BaseMaterial && Parameters == Other.Parameters;
+		}
+
+		friend uint32 GetTypeHash(const FSharedMaterialKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.BaseMaterial), GetTypeHash(Key.Parameters));
+		}
+	};
+
+	struct FSharedMaterialEntry
+	{
+		TObjectPtr<UMaterialInstanceDynamic>				Material;
+		/** How many meshes have this Material applied. */
+		int32															MeshCount = 0;
+	};
+
+	/** Updates overlay material counted for the mesh, releasing the previous one. */
+	void SetAppliedOverlayMaterial(FMeshHighlightEntry& Entry, UMaterialInterface* Material);
+
+	/** Removes Shared Materials which no mesh uses anymore. */
+	void EvictUnusedSharedMaterials();
+
+private:
+
+	/** Owns Shared Material Instances, kept alive by AddReferencedObjects. */
+	TMap<FSharedMaterialKey, FSharedMaterialEntry>									SharedMaterials;
+
+	/** Key of each Shared Material Instance, so meshes can release it. */
+	TMap<TObjectKey<UMaterialInterface>, FSharedMaterialKey>					SharedMaterialKeys;
+
+	/** Shared Materials with no mesh, evicted after flush unless applied meanwhile. */
+	TSet<FSharedMaterialKey>																UnusedSharedMaterials;
+
+	TMap<TObjectKey<UObject>, FProgressHighlightEntry>						ProgressHighlights;
+
+	TMap<TObjectKey<UMeshComponent>, FMeshHighlightEntry>	MeshEntries;
+	TSet<TObjectKey<UMeshComponent>>								DirtyMeshes;
+
+	int32																			RequestedUpdates = 0;
+	int32																			AppliedUpdates = 0;
+};
@@ -0,0 +1,113 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "MounteaInteractionDependencySubsystem.generated.h"
+
+/**
+ * Mountea Interaction Dependency Subsystem
+ *
+ * Holds Interaction Dependencies of Interactables and Interactors as one directed graph, edges lead from Master to Dependency.
+ * Edges which would close a cycle are refused when added, so the graph is always acyclic.
+ *
+ * State changes only mark Master dirty. Once the world has ticked, dirty Masters and everything reachable from them
+ * are sorted topologically and each dirty node processes its Dependencies exactly once,
+ * so chained Dependencies are propagated in a single pass.
+ */
+UCLASS()
+class MOUNTEAINTERACTIONSYSTEM_API UMounteaInteractionDependencySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UMounteaInteractionDependencySubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Adds edge from Master to Dependency.
+	 * Returns false if Dependency already depends, directly or not, on Master, in which case the edge is not added.
+	 */
+	bool AddDependency(const UObject* Master, const UObject* Dependency);
+	void RemoveDependency(const UObject* Master, const UObject* Dependency);
+
+	/** Removes node with all of its edges. */
+	void RemoveNode(const UObject* Node);
+
+	/** Returns whether adding edge from Master to Dependency would close a cycle. */
+	bool WouldCreateCycle(const UObject* Master, const UObject* Dependency) const;
+
+	/**
+	 * Queues processing of Master's Dependencies for the end of this frame.
+	 * Returns false if Master has no Dependencies in the graph, so there is nothing to process.
+	 */
+	bool MarkDirty(const UObject* Master);
+
+	/** Processes all dirty nodes immediately, in topological order. */
+	void FlushDependencies();
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Dependencies")
+	TArray<UObject*> GetDependencies(const UObject* Master) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Dependencies")
+	TArray<UObject*> GetMasters(const UObject* Dependency) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Dependencies")
+	int32 GetNodesCount() const
+	{ return Nodes.Num(); };
+
+	/** Returns how many times nodes processed their Dependencies since the World started. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Dependencies")
+	int32 GetProcessedNodesCount() const
+	{ return ProcessedNodes; };
+
+	/** Returns how many processing requests were merged into already pending ones. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Dependencies")
+	int32 GetMergedRequestsCount() const
+	{ return MergedRequests; };
+
+	/** Returns readable description of the whole graph, one Master per line. */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Interaction|Dependencies")
+	FString DescribeGraph() const;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	/** State can change while paused, for example from UI. */
+	virtual bool IsTickableWhenPaused() const override
+	{ return true; };
+	virtual TStatId GetStatId() const override;
+
+private:
+
+	struct FDependencyNode
+	{
+		TWeakObjectPtr<UObject>							Object;
+		TArray<TObjectKey<UObject>>						Dependencies;
+		TArray<TObjectKey<UObject>>						Masters;
+	};
+
+	FDependencyNode& FindOrAddNode(const UObject* Object);
+	/** Removes node if it has no edges left. */
+	void RemoveNodeIfUnused(const TObjectKey<UObject>& Key);
+
+	/** Appends dirty nodes and all nodes reachable from them, in topological order. */
+	void SortDirtyNodes(TArray<TObjectKey<UObject>>& OutOrder) const;
+
+private:
+
+	TMap<TObjectKey<UObject>, FDependencyNode>				Nodes;
+	TSet<TObjectKey<UObject>>										DirtyNodes;
+
+	bool																			bIsFlushing = false;
+
+	int32																			ProcessedNodes = 0;
+	int32																			MergedRequests = 0;
+};
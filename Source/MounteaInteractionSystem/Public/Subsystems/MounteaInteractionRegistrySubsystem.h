@@ -0,0 +1,171 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Helpers/MounteaInteractionHandles.h"
+
+#include "MounteaInteractionRegistrySubsystem.generated.h"
+
+class UMounteaInteractableComponentBase;
+class UMounteaInteractorComponentBase;
+class AMounteaInteractionStateManager;
+
+/**
+ * Mountea Interaction Registry Subsystem
+ *
+ * Keeps track of all Interactable and Interactor Components which have begun play in this World.
+ * Components register themselves in BeginPlay and unregister in EndPlay.
+ *
+ * Allows systems like Replication Graph to work with Interactables without iterating Actors.
+ * Spawns Interaction State Manager on Server when enabled in Settings.
+ *
+ * Owns slots of Interactable and Interactor Handles. Slots are shared by all Worlds.
+ */
+UCLASS()
+class MOUNTEAINTERACTIONSYSTEM_API UMounteaInteractionRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UMounteaInteractionRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	void RegisterInteractable(UMounteaInteractableComponentBase* Interactable);
+	void UnregisterInteractable(UMounteaInteractableComponentBase* Interactable);
+
+	/**
+	 * Queues Interactable to complete its registration in one of the next frames, if time-slicing is enabled in Settings.
+	 * Returns false if Interactable is expected to complete its registration right away.
+	 */
+	bool QueueInteractableRegistration(UMounteaInteractableComponentBase* Interactable);
+
+	int32 GetPendingInteractablesCount() const
+	{ return PendingInteractables.Num(); };
+
+	void RegisterInteractor(UMounteaInteractorComponentBase* Interactor);
+	void UnregisterInteractor(UMounteaInteractorComponentBase* Interactor);
+
+	/** Returns all registered Interactables. Entries might be stale if Component was destroyed without EndPlay. */
+	const TArray<TWeakObjectPtr<UMounteaInteractableComponentBase>>& GetInteractables() const
+	{ return Interactables.Entries; };
+
+	/** Returns all registered Interactors. Entries might be stale if Component was destroyed without EndPlay. */
+	const TArray<TWeakObjectPtr<UMounteaInteractorComponentBase>>& GetInteractors() const
+	{ return Interactors.Entries; };
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Registry")
+	int32 GetInteractablesCount() const
+	{ return Interactables.Entries.Num(); };
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Registry")
+	int32 GetInteractorsCount() const
+	{ return Interactors.Entries.Num(); };
+
+	/** Returns Interaction State Manager of this World. Valid on Server and on Clients once replicated. */
+	AMounteaInteractionStateManager* GetInteractionStateManager() const
+	{ return InteractionStateManager.Get(); };
+
+	void SetInteractionStateManager(AMounteaInteractionStateManager* NewStateManager)
+	{ InteractionStateManager = NewStateManager; };
+
+	/** Returns Handle of Object implementing Interactable Interface. Same Object always gets the same Handle until released. */
+	static FMounteaInteractableHandle AcquireInteractableHandle(const UObject* Interactable);
+	/** Frees slot of Interactable, so its Handles do not resolve anymore. */
+	static void ReleaseInteractableHandle(const UObject* Interactable);
+	static UObject* ResolveInteractableHandle(const FMounteaInteractableHandle& Handle);
+
+	/** Returns Handle of Object implementing Interactor Interface. Same Object always gets the same Handle until released. */
+	static FMounteaInteractorHandle AcquireInteractorHandle(const UObject* Interactor);
+	/** Frees slot of Interactor, so its Handles do not resolve anymore. */
+	static void ReleaseInteractorHandle(const UObject* Interactor);
+	static UObject* ResolveInteractorHandle(const FMounteaInteractorHandle& Handle);
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+private:
+
+	/** Completes registration of queued Interactables within Registration Budget. */
+	void ProcessPendingRegistrations();
+	void SchedulePendingRegistrations();
+
+private:
+
+	template<typename ComponentType>
+	struct TRegistryEntries
+	{
+		TArray<TWeakObjectPtr<ComponentType>>					Entries;
+		/** Keys of Entries, so indices can be fixed even for stale Entries. */
+		TArray<TObjectKey<ComponentType>>						Keys;
+		TMap<TObjectKey<ComponentType>, int32>				Indices;
+
+		void Add(ComponentType* Component)
+		{
+			if (!Component || Indices.Contains(Component)) return;
+
+			Indices.Add(Component, Entries.Add(Component));
+			Keys.Add(Component);
+		}
+
+		void Remove(ComponentType* Component)
+		{
+			int32 Index = INDEX_NONE;
+			if (!Component || !Indices.RemoveAndCopyValue(Component, Index)) return;
+
+			// Swap last entry into the gap, so removal does not shift the whole array
+			Entries.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			Keys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			if (Keys.IsValidIndex(Index))
+			{
+				Indices.Add(Keys[Index], Index);
+			}
+		}
+
+		void Empty()
+		{
+			Entries.Empty();
+			Keys.Empty();
+			Indices.Empty();
+		}
+	};
+
+private:
+
+	TRegistryEntries<UMounteaInteractableComponentBase>						Interactables;
+	TRegistryEntries<UMounteaInteractorComponentBase>							Interactors;
+
+	TWeakObjectPtr<AMounteaInteractionStateManager>							InteractionStateManager;
+
+	/** Interactables which have begun play, but have not completed their registration yet. */
+	TArray<TWeakObjectPtr<UMounteaInteractableComponentBase>>				PendingInteractables;
+	bool																					bPendingRegistrationsScheduled = false;
+
+	struct FHandleSlots
+	{
+		TArray<TWeakObjectPtr<const UObject>>								Objects;
+		/** Generation of each slot, increased once the slot is freed. Zero is never used. */
+		TArray<uint32>																	Generations;
+		TArray<int32>																		FreeIndices;
+		TMap<TObjectKey<UObject>, int32>											Indices;
+
+		/** Returns slot index of Object, allocating new slot if needed. */
+		int32 Acquire(const UObject* Object);
+		void Release(const UObject* Object);
+		/** Frees slots whose Objects have been destroyed without release. */
+		void ReleaseStale();
+
+		const UObject* Resolve(const int32 Index, const uint32 Generation) const
+		{
+			return Generations.IsValidIndex(Index) && Generations[Index] == Generation ? Objects[Index].Get() : nullptr;
+		}
+	};
+
+	static FHandleSlots																InteractableSlots;
+	static FHandleSlots																InteractorSlots;
+};
@@ -0,0 +1,78 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Helpers/MounteaInteractionHelpers.h"
+
+#include "MounteaServerRPCLimiterSubsystem.generated.h"
+
+class UNetConnection;
+
+/**
+ * Mountea Server RPC Limiter Subsystem
+ *
+ * Keeps token bucket per Client Connection and Server RPC type.
+ * Interactors ask for a token before doing any work in their Server RPCs, so flooding Client cannot consume Server CPU.
+ * Budgets are defined in Mountea Interaction System Settings.
+ */
+UCLASS()
+class MOUNTEAINTERACTIONSYSTEM_API UMounteaServerRPCLimiterSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UMounteaServerRPCLimiterSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Consumes one token of RPC Type from Connection's budget.
+	 * Budget is raised to at least Min Tokens Per Second, with Burst Size of one second worth of tokens.
+	 * Returns false if budget is exhausted and the call should be dropped or deferred.
+	 */
+	bool ConsumeToken(const UNetConnection* Connection, const EMounteaServerRPCType RPCType, const float MinTokensPerSecond = 0.f);
+
+	/** Returns how long it takes to refill one token of RPC Type, in seconds. */
+	float GetTokenInterval(const EMounteaServerRPCType RPCType) const;
+
+	/** Returns how many calls of RPC Type were dropped or deferred. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Networking")
+	int32 GetDroppedCount(const EMounteaServerRPCType RPCType) const;
+
+	/** Returns how many calls were dropped or deferred in total. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Networking")
+	int32 GetTotalDroppedCount() const;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+private:
+
+	struct FTokenBucket
+	{
+		/** Negative until first use, then bucket starts full. */
+		float							Tokens = -1.f;
+		double						LastRefillTime = 0.0;
+	};
+
+	struct FConnectionBuckets
+	{
+		FTokenBucket				Buckets[static_cast<int32>(EMounteaServerRPCType::Default)];
+	};
+
+	/** Removes Buckets of closed Connections. */
+	void PruneConnections(const double Now);
+
+private:
+
+	TMap<TObjectKey<UNetConnection>, FConnectionBuckets>		ConnectionBuckets;
+
+	TArray<int32>																DroppedCounts;
+
+	double																			LastPruneTime = 0.0;
+};
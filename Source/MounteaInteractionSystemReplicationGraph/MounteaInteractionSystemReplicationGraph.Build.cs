@@ -0,0 +1,30 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+using UnrealBuildTool;
+
+public class MounteaInteractionSystemReplicationGraph : ModuleRules
+{
+	public MounteaInteractionSystemReplicationGraph(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange
+		(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"ReplicationGraph"
+			}
+		);
+		
+		PrivateDependencyModuleNames.AddRange
+		(
+			new string[]
+			{
+				"MounteaInteractionSystem"
+			}
+		);
+	}
+}
@@ -0,0 +1,5 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, MounteaInteractionSystemReplicationGraph)
@@ -0,0 +1,292 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Networking/MounteaReplicationGraphNode_Interactables.h"
+
+#include "Components/SceneComponent.h"
+#include "Engine/NetConnection.h"
+#include "GameFramework/Actor.h"
+
+#include "Components/Interactable/MounteaInteractableComponentBase.h"
+#include "Helpers/MounteaInteractionSystemSettings.h"
+#include "Interfaces/MounteaInteractorInterface.h"
+
+UMounteaReplicationGraphNode_Interactables::UMounteaReplicationGraphNode_Interactables()
+{
+	bRequiresPrepareForReplicationCall = true;
+
+	const UMounteaInteractionSystemSettings* Settings = GetDefault<UMounteaInteractionSystemSettings>();
+	RelevancyRange = FMath::Max(100.f, Settings->GetInteractableRelevancyRange());
+	ActiveReplicationPeriodFrame = static_cast<uint32>(FMath::Max(1, Settings->GetActiveInteractableReplicationPeriodFrame()));
+	IdleReplicationPeriodFrame = static_cast<uint32>(FMath::Max(1, Settings->GetIdleInteractableReplicationPeriodFrame()));
+}
+
+bool UMounteaReplicationGraphNode_Interactables::IsInteractableActor(const AActor* Actor)
+{
+	return Actor && Actor->FindComponentByClass<UMounteaInteractableComponentBase>() != nullptr;
+}
+
+void UMounteaReplicationGraphNode_Interactables::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	AActor* Actor = ActorInfo.Actor;
+	if (!IsInteractableActor(Actor) || ActorCells.Contains(Actor)) return;
+
+	const FIntPoint Cell = GetCell(Actor->GetActorLocation());
+	ActorCells.Add(Actor, Cell);
+	Cells.FindOrAdd(Cell).Add(Actor);
+
+	if (Actor->IsRootComponentMovable())
+	{
+		MovableActors.Add(Actor);
+	}
+
+	TInlineComponentArray<UMounteaInteractableComponentBase*> Interactables(Actor);
+	for (UMounteaInteractableComponentBase* Itr : Interactables)
+	{
+		Itr->OnInteractorChangedNative.AddUObject(this, &UMounteaReplicationGraphNode_Interactables::OnInteractorChanged, Actor);
+	}
+
+	// Actor might have been routed with Interactor already set
+	UpdateActiveActor(Actor);
+}
+
+bool UMounteaReplicationGraphNode_Interactables::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+	AActor* Actor = ActorInfo.Actor;
+	if (!ActorCells.Contains(Actor)) return false;
+
+	RemoveActor(Actor);
+	return true;
+}
+
+void UMounteaReplicationGraphNode_Interactables::NotifyResetAllNetworkActors()
+{
+	for (const auto& Itr : ActorCells)
+	{
+		TInlineComponentArray<UMounteaInteractableComponentBase*> Interactables(Itr.Key);
+		for (UMounteaInteractableComponentBase* Interactable : Interactables)
+		{
+			Interactable->OnInteractorChangedNative.RemoveAll(this);
+		}
+	}
+
+	ActorCells.Reset();
+	MovableActors.Reset();
+	Cells.Reset();
+	ActiveActorsByConnection.Reset();
+	ActiveActorConnections.Reset();
+	ActiveActors.Reset();
+	ConnectionLists.Reset();
+}
+
+void UMounteaReplicationGraphNode_Interactables::PrepareForReplication()
+{
+	for (auto It = ConnectionLists.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Static Actors never leave their Cell
+	for (AActor* const Itr : MovableActors)
+	{
+		FIntPoint& ActorCell = ActorCells.FindChecked(Itr);
+		const FIntPoint NewCell = GetCell(Itr->GetActorLocation());
+		if (NewCell == ActorCell) continue;
+
+		if (TArray<AActor*>* CellActors = Cells.Find(ActorCell))
+		{
+			CellActors->RemoveSingleSwap(Itr);
+			if (CellActors->Num() == 0)
+			{
+				Cells.Remove(ActorCell);
+			}
+		}
+
+		Cells.FindOrAdd(NewCell).Add(Itr);
+		ActorCell = NewCell;
+	}
+}
+
+void UMounteaReplicationGraphNode_Interactables::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	FActorRepListRefView& ReplicationList = ConnectionLists.FindOrAdd(&Params.ConnectionManager);
+	ReplicationList.Reset();
+
+	const float RelevancyRangeSquared = FMath::Square(RelevancyRange);
+	for (const FNetViewer& Viewer : Params.Viewers)
+	{
+		const FIntPoint ViewerCell = GetCell(Viewer.ViewLocation);
+
+		// Cells have Relevancy Range size, so neighbours cover the whole range
+		for (int32 X = -1; X <= 1; X++)
+		{
+			for (int32 Y = -1; Y <= 1; Y++)
+			{
+				const TArray<AActor*>* CellActors = Cells.Find(ViewerCell + FIntPoint(X, Y));
+				if (!CellActors) continue;
+
+				for (AActor* const Itr : *CellActors)
+				{
+					if (FVector::DistSquared(Itr->GetActorLocation(), Viewer.ViewLocation) <= RelevancyRangeSquared)
+					{
+						ReplicationList.ConditionalAdd(Itr);
+						UpdateConnectionReplicationPeriod(Params.ConnectionManager, Itr);
+					}
+				}
+			}
+		}
+	}
+
+	if (const TArray<AActor*>* ConnectionActiveActors = ActiveActorsByConnection.Find(Params.ConnectionManager.NetConnection))
+	{
+		for (AActor* const Itr : *ConnectionActiveActors)
+		{
+			ReplicationList.ConditionalAdd(Itr);
+			UpdateConnectionReplicationPeriod(Params.ConnectionManager, Itr);
+		}
+	}
+
+	if (ReplicationList.Num() > 0)
+	{
+		Params.OutGatheredReplicationLists.AddReplicationActorList(ReplicationList);
+	}
+}
+
+void UMounteaReplicationGraphNode_Interactables::LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const
+{
+	DebugInfo.Log(NodeName);
+	DebugInfo.PushIndent();
+	DebugInfo.Log(FString::Printf(TEXT("Relevancy Range: %.1f, Actors: %d, Movable: %d, Active: %d, Cells: %d, Active Connections: %d"), RelevancyRange, ActorCells.Num(), MovableActors.Num(), ActiveActors.Num(), Cells.Num(), ActiveActorsByConnection.Num()));
+	DebugInfo.PopIndent();
+}
+
+void UMounteaReplicationGraphNode_Interactables::RemoveActor(AActor* Actor)
+{
+	TInlineComponentArray<UMounteaInteractableComponentBase*> Interactables(Actor);
+	for (UMounteaInteractableComponentBase* Itr : Interactables)
+	{
+		Itr->OnInteractorChangedNative.RemoveAll(this);
+	}
+
+	FIntPoint ActorCell;
+	if (ActorCells.RemoveAndCopyValue(Actor, ActorCell))
+	{
+		if (TArray<AActor*>* CellActors = Cells.Find(ActorCell))
+		{
+			CellActors->RemoveSingleSwap(Actor);
+			if (CellActors->Num() == 0)
+			{
+				Cells.Remove(ActorCell);
+			}
+		}
+	}
+	MovableActors.RemoveSingleSwap(Actor);
+
+	if (const auto* Connections = ActiveActorConnections.Find(Actor))
+	{
+		for (const TObjectKey<UNetConnection>& Itr : *Connections)
+		{
+			if (TArray<AActor*>* ConnectionActiveActors = ActiveActorsByConnection.Find(Itr))
+			{
+				ConnectionActiveActors->RemoveSingleSwap(Actor);
+				if (ConnectionActiveActors->Num() == 0)
+				{
+					ActiveActorsByConnection.Remove(Itr);
+				}
+			}
+		}
+		ActiveActorConnections.Remove(Actor);
+	}
+	ActiveActors.Remove(Actor);
+}
+
+void UMounteaReplicationGraphNode_Interactables::UpdateActiveActor(AActor* Actor)
+{
+	// Actor with multiple Interactables is active if any of them is
+	bool bIsActive = false;
+	TArray<TObjectKey<UNetConnection>, TInlineAllocator<1>> NewConnections;
+
+	TInlineComponentArray<UMounteaInteractableComponentBase*> Interactables(Actor);
+	for (UMounteaInteractableComponentBase* Itr : Interactables)
+	{
+		const TScriptInterface<IMounteaInteractorInterface> Interactor = IMounteaInteractableInterface::Execute_GetInteractor(Itr);
+		const UActorComponent* InteractorComponent = Cast<UActorComponent>(Interactor.GetObject());
+		const AActor* InteractorActor = InteractorComponent ? InteractorComponent->GetOwner() : nullptr;
+		if (!InteractorActor) continue;
+
+		bIsActive = true;
+		if (const UNetConnection* InteractorConnection = InteractorActor->GetNetConnection())
+		{
+			NewConnections.AddUnique(InteractorConnection);
+		}
+	}
+
+	TArray<TObjectKey<UNetConnection>, TInlineAllocator<1>> OldConnections;
+	ActiveActorConnections.RemoveAndCopyValue(Actor, OldConnections);
+
+	for (const TObjectKey<UNetConnection>& Itr : OldConnections)
+	{
+		if (NewConnections.Contains(Itr)) continue;
+
+		if (TArray<AActor*>* ConnectionActiveActors = ActiveActorsByConnection.Find(Itr))
+		{
+			ConnectionActiveActors->RemoveSingleSwap(Actor);
+			if (ConnectionActiveActors->Num() == 0)
+			{
+				ActiveActorsByConnection.Remove(Itr);
+			}
+		}
+	}
+
+	for (const TObjectKey<UNetConnection>& Itr : NewConnections)
+	{
+		if (OldConnections.Contains(Itr)) continue;
+
+		ActiveActorsByConnection.FindOrAdd(Itr).Add(Actor);
+	}
+
+	if (NewConnections.Num() > 0)
+	{
+		ActiveActorConnections.Add(Actor, MoveTemp(NewConnections));
+	}
+
+	if (bIsActive)
+	{
+		ActiveActors.Add(Actor);
+	}
+	else
+	{
+		ActiveActors.Remove(Actor);
+	}
+
+	// Global Settings are used only for Connection Actor Infos created from now on
+	if (GraphGlobals.IsValid() && GraphGlobals->GlobalActorReplicationInfoMap)
+	{
+		if (FGlobalActorReplicationInfo* ActorInfo = GraphGlobals->GlobalActorReplicationInfoMap->Find(Actor))
+		{
+			ActorInfo->Settings.ReplicationPeriodFrame = bIsActive ? ActiveReplicationPeriodFrame : IdleReplicationPeriodFrame;
+		}
+	}
+}
+
+void UMounteaReplicationGraphNode_Interactables::OnInteractorChanged(const TScriptInterface<IMounteaInteractorInterface>& NewInteractor, AActor* InteractableActor)
+{
+	if (!ActorCells.Contains(InteractableActor)) return;
+
+	UpdateActiveActor(InteractableActor);
+}
+
+void UMounteaReplicationGraphNode_Interactables::UpdateConnectionReplicationPeriod(UNetReplicationGraphConnection& ConnectionManager, AActor* Actor) const
+{
+	FConnectionReplicationActorInfo* ConnectionActorInfo = ConnectionManager.ActorInfoMap.Find(Actor);
+	if (!ConnectionActorInfo) return;
+
+	ConnectionActorInfo->ReplicationPeriodFrame = static_cast<uint16>(ActiveActors.Contains(Actor) ? ActiveReplicationPeriodFrame : IdleReplicationPeriodFrame);
+}
+
+FIntPoint UMounteaReplicationGraphNode_Interactables::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / RelevancyRange), FMath::FloorToInt(Location.Y / RelevancyRange));
+}
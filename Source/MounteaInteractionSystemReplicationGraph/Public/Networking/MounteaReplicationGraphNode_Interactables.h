@@ -0,0 +1,88 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "UObject/ObjectKey.h"
+
+#include "MounteaReplicationGraphNode_Interactables.generated.h"
+
+class IMounteaInteractorInterface;
+
+/**
+ * Replication Graph Node for Interactables
+ *
+ * Optional node for projects using Replication Graph, shipped in its own module so projects without Replication Graph do not depend on it.
+ * Add this node as a Global Node of your Replication Graph and route Actors for which IsInteractableActor returns true to it instead of spatial nodes.
+ *
+ * - Interactables are relevant only to Connections whose viewers are within Relevancy Range.
+ * - Interactables with Interactor are always relevant to the Connection owning that Interactor.
+ * - Interactables with Interactor replicate more often than idle ones.
+ *
+ * Actors are tracked incrementally: only Movable Actors are re-celled each frame and active Actors are updated once their Interactor changes.
+ * Values are taken from Mountea Interaction System Settings.
+ */
+UCLASS()
+class MOUNTEAINTERACTIONSYSTEMREPLICATIONGRAPH_API UMounteaReplicationGraphNode_Interactables : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+
+	UMounteaReplicationGraphNode_Interactables();
+
+	/** Returns whether Actor owns any Interactable. */
+	static bool IsInteractableActor(const AActor* Actor);
+
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override;
+	virtual void NotifyResetAllNetworkActors() override;
+
+	virtual void PrepareForReplication() override;
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	virtual void LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const override;
+
+private:
+
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/** Stops listening to Interactables of Actor and removes it from all lists. */
+	void RemoveActor(AActor* Actor);
+
+	/** Moves Actor to Connection lists of its current Interactors and updates its Replication Period. */
+	void UpdateActiveActor(AActor* Actor);
+
+	void OnInteractorChanged(const TScriptInterface<IMounteaInteractorInterface>& NewInteractor, AActor* InteractableActor);
+
+	/** Applies Replication Period of Actor to Connection's copy of its Actor Info, which is not refreshed from Global Settings. */
+	void UpdateConnectionReplicationPeriod(UNetReplicationGraphConnection& ConnectionManager, AActor* Actor) const;
+
+private:
+
+	/** Cell of each routed Interactable Actor. */
+	TMap<AActor*, FIntPoint>																	ActorCells;
+
+	/** Routed Actors which can move, so their Cell is checked every frame. */
+	TArray<AActor*>																				MovableActors;
+
+	/** Interactable Actors bucketed to cells of Relevancy Range size. */
+	TMap<FIntPoint, TArray<AActor*>>														Cells;
+
+	/** Interactable Actors whose Interactor is owned by Connection. */
+	TMap<TObjectKey<UNetConnection>, TArray<AActor*>>								ActiveActorsByConnection;
+
+	/** Connections each active Actor is listed for, so it can be removed without searching all of them. */
+	TMap<AActor*, TArray<TObjectKey<UNetConnection>, TInlineAllocator<1>>>	ActiveActorConnections;
+
+	/** Interactable Actors with any Interactor. */
+	TSet<AActor*>																					ActiveActors;
+
+	/** Gathered lists must stay alive until replication of the frame is finished. */
+	TMap<TObjectKey<UNetReplicationGraphConnection>, FActorRepListRefView>	ConnectionLists;
+
+	float																									RelevancyRange;
+	uint32																								ActiveReplicationPeriodFrame;
+	uint32																								IdleReplicationPeriodFrame;
+};